@@ -0,0 +1,140 @@
+#include "Algorithm.hpp"
+#include "RDT_CoreDefs.h"
+
+#include "Array.hpp"
+#include "List.hpp"
+#include "Vector.hpp"
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+RDT_BEGIN
+
+using namespace rds;
+using namespace std;
+
+template <class __T_t>
+class SimdAlgorithm: public ::testing::Test
+{
+public:
+    /** @brief 레인 경계 앞뒤의 크기를 모두 확인할 수 있도록 무작위 값들을 만든다. */
+    static auto MakeValues(std::size_t count, unsigned seed) -> vector<__T_t>
+    {
+        mt19937 rng(seed);
+        vector<__T_t> values(count);
+        for (auto& v : values)
+            v = static_cast<__T_t>(static_cast<int>(rng() % 64) - 32);
+        return values;
+    }
+
+    /** @brief 원소를 하나씩 비교하는 \ref List 의 결과와 같은지 확인한다. */
+    static auto ExpectSameAsList(const vector<__T_t>& values) -> void
+    {
+        Vector<__T_t> vec(values.size());
+        List<__T_t>   li;
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            vec[i] = values[i];
+            li.PushBack(values[i]);
+        }
+
+        const auto index = [&](auto it) { return it - vec.CBegin(); };
+        const auto li_index = [&](auto it)
+        { return static_cast<std::ptrdiff_t>(DistanceBetween(li.CBegin(), it)); };
+
+        EXPECT_EQ(index(MinElement(vec.CBegin(), vec.CEnd())),
+                  li_index(MinElement(li.CBegin(), li.CEnd())));
+        EXPECT_EQ(MinElement(vec.Begin(), vec.End()) - vec.Begin(),
+                  index(MinElement(vec.CBegin(), vec.CEnd())));
+        EXPECT_EQ(index(MaxElement(vec.CBegin(), vec.CEnd())),
+                  li_index(MaxElement(li.CBegin(), li.CEnd())));
+
+        for (const __T_t key : {__T_t(-32), __T_t(0), __T_t(31), __T_t(100)})
+        {
+            EXPECT_EQ(index(Find(vec.CBegin(), vec.CEnd(), key)),
+                      li_index(Find(li.CBegin(), li.CEnd(), key)));
+            EXPECT_EQ(Count(vec.CBegin(), vec.CEnd(), key),
+                      Count(li.CBegin(), li.CEnd(), key));
+        }
+    }
+};
+
+using SimdTypes = ::testing::Types<std::int32_t, std::uint32_t, std::int64_t,
+                                   std::uint64_t, float, double>;
+TYPED_TEST_SUITE(SimdAlgorithm, SimdTypes);
+
+TYPED_TEST(SimdAlgorithm, SameAsScalar)
+{
+    for (std::size_t count : {1, 2, 3, 7, 8, 9, 31, 33, 1023, 1024, 1025, 5000})
+        TestFixture::ExpectSameAsList(TestFixture::MakeValues(count, static_cast<unsigned>(count)));
+}
+
+TYPED_TEST(SimdAlgorithm, FirstOfEqualElements)
+{
+    vector<TypeParam> values(3000, TypeParam(5));
+    values[1500] = TypeParam(1);
+    values[2999] = TypeParam(1);
+    values[100]  = TypeParam(9);
+    values[2000] = TypeParam(9);
+
+    TestFixture::ExpectSameAsList(values);
+}
+
+TEST(__SimdAlgorithm, Pointer)
+{
+    int arr[5] = {4, 1, 3, 1, 4};
+    EXPECT_EQ(MinElement(arr, arr + 5), arr + 1);
+    EXPECT_EQ(MaxElement(arr, arr + 5), arr);
+    EXPECT_EQ(Find(arr, arr + 5, 3), arr + 2);
+    EXPECT_EQ(Find(arr, arr + 5, 7), arr + 5);
+    EXPECT_EQ(Count(arr, arr + 5, 4), 2u);
+    EXPECT_EQ(MinElement(arr, arr), arr);
+    EXPECT_EQ(Count(arr, arr, 4), 0u);
+}
+
+TEST(__SimdAlgorithm, Array)
+{
+    Array<float, 20> arr = {};
+    arr[13]              = -1.5f;
+    arr[17]              = 2.5f;
+    EXPECT_EQ(*MinElement(arr.CBegin(), arr.CEnd()), -1.5f);
+    EXPECT_EQ(*MaxElement(arr.Begin(), arr.End()), 2.5f);
+    EXPECT_EQ(Count(arr.CBegin(), arr.CEnd(), 0.0f), 18u);
+}
+
+TEST(__SimdAlgorithm, MixedTypeUsesScalarComparison)
+{
+    // 2.5 는 int 로 바꾸면 2 가 되지만, operator== 는 double 로 비교하므로 찾지 못해야 한다.
+    int arr[4] = {1, 2, 3, 4};
+    EXPECT_EQ(Find(arr, arr + 4, 2.5), arr + 4);
+    EXPECT_EQ(Count(arr, arr + 4, 2.5), 0u);
+}
+
+TEST(__SimdAlgorithm, NaN)
+{
+    const double nan = numeric_limits<double>::quiet_NaN();
+
+    vector<double> values(100, 1.0);
+    values[10] = nan;
+    values[50] = -1.0;
+    values[70] = 2.0;
+    EXPECT_EQ(MinElement(values.data(), values.data() + 100), values.data() + 50);
+    EXPECT_EQ(MaxElement(values.data(), values.data() + 100), values.data() + 70);
+    EXPECT_EQ(Find(values.data(), values.data() + 100, nan), values.data() + 100);
+
+    // 첫 원소가 NaN이면 비교자 버전과 같이 첫 원소를 반환한다.
+    values[0] = nan;
+    EXPECT_EQ(MinElement(values.data(), values.data() + 100), values.data());
+}
+
+TEST(__SimdAlgorithm, SignedZero)
+{
+    float arr[16] = {};
+    arr[3]        = -0.0f;
+    EXPECT_EQ(MinElement(arr, arr + 16), arr);
+    EXPECT_EQ(Find(arr, arr + 16, -0.0f), arr);
+    EXPECT_EQ(Count(arr, arr + 16, 0.0f), 16u);
+}
+
+RDT_END
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include "AllocatorTraits.hpp"
+#include "List.hpp"
+#include "Pallocator.hpp"
+#include "RDT_CoreDefs.h"
+
+RDT_BEGIN
+
+using namespace rds;
+
+TEST(Pallocator_Allocate, reuse)
+{
+    int* first = Pallocator<int>().Allocate(1);
+    Pallocator<int>().Deallocate(first);
+
+    // 방금 반환된 슬롯이 자유 리스트의 맨 앞에 있어야 한다.
+    int* second = Pallocator<int>().Allocate(1);
+    EXPECT_EQ(first, second);
+    Pallocator<int>().Deallocate(second);
+}
+
+TEST(Pallocator_Allocate, adjacent)
+{
+    double* a = Pallocator<double>().Allocate(1);
+    double* b = Pallocator<double>().Allocate(1);
+
+    // 새 블록에서 연속으로 할당된 노드는 인접해 있어야 한다.
+    EXPECT_EQ(reinterpret_cast<char*>(b) - reinterpret_cast<char*>(a),
+              static_cast<std::ptrdiff_t>(sizeof(double)));
+
+    Pallocator<double>().Deallocate(a);
+    Pallocator<double>().Deallocate(b);
+}
+
+TEST(Pallocator_Allocate, array)
+{
+    // 노드 하나보다 큰 할당은 풀을 거치지 않는다.
+    const auto block_count = NodePool<long>::Get().BlockCount();
+    long*      ptr         = Pallocator<long>().Allocate(100);
+    ptr[99]                = 1;
+    Pallocator<long>().Deallocate(ptr, 100);
+    EXPECT_EQ(NodePool<long>::Get().BlockCount(), block_count);
+}
+
+TEST(Pallocator_List, insert_erase)
+{
+    List<int, Pallocator> li;
+
+    for (int i = 0; i < 10000; ++i)
+        li.PushBack(i);
+    EXPECT_EQ(li.Size(), 10000);
+    EXPECT_EQ(li.Back(), 9999);
+
+    // 지운 노드들이 재사용되므로 블록이 더 늘어나지 않아야 한다.
+    const auto block_count = NodePool<Node_D<int>>::Get().BlockCount();
+    li.Clear();
+    for (int i = 0; i < 10000; ++i)
+        li.PushFront(i);
+    EXPECT_EQ(li.Front(), 9999);
+    EXPECT_EQ(NodePool<Node_D<int>>::Get().BlockCount(), block_count);
+}
+
+TEST(Pallocator_List, per_instance_pool)
+{
+    NodePool<Node_D<int>> pool;
+    {
+        List<int, Pallocator> li{Pallocator<Node_D<int>>(pool)};
+        for (int i = 0; i < 100; ++i)
+            li.PushBack(i);
+
+        // 복사하면 같은 풀을 사용하고, 이동하면 할당자도 함께 옮겨간다.
+        List<int, Pallocator> copied(li);
+        List<int, Pallocator> moved;
+        moved = static_cast<List<int, Pallocator>&&>(copied);
+        EXPECT_TRUE(moved.GetAllocator() == li.GetAllocator());
+        EXPECT_EQ(moved.Size(), 100);
+    }
+    EXPECT_EQ(pool.BlockCount(), 1);
+}
+
+TEST(AllocatorStorage, empty_base)
+{
+    // 상태가 없는 할당자는 리스트의 크기를 늘리지 않는다.
+    EXPECT_EQ(sizeof(List<int, Nallocator>), sizeof(List<int, Mallocator>));
+    EXPECT_EQ(sizeof(List<int, Pallocator>),
+              sizeof(List<int, Nallocator>) + sizeof(void*));
+}
+
+RDT_END
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include "AllocatorTraits.hpp"
+#include "List.hpp"
+#include "Sallocator.hpp"
+#include "Vector.hpp"
+#include "RDT_CoreDefs.h"
+
+RDT_BEGIN
+
+using namespace rds;
+
+TEST(Sallocator_Allocate, stats)
+{
+    const auto before = alloc_tracker::snapshot();
+
+    double* ptr = Sallocator<double>().Allocate(100);
+    auto    s   = alloc_tracker::snapshot();
+    EXPECT_EQ(s.bytes_in_use - before.bytes_in_use, 800);
+    EXPECT_EQ(s.allocations - before.allocations, 1);
+
+    Sallocator<double>().Deallocate(ptr, 100);
+    s = alloc_tracker::snapshot();
+    EXPECT_EQ(s.bytes_in_use, before.bytes_in_use);
+    EXPECT_EQ(s.deallocations - before.deallocations, 1);
+}
+
+TEST(Sallocator_List, tag)
+{
+    const auto tag = alloc_tracker::tag("Sallocator_List");
+    {
+        List<int, Sallocator> li(Sallocator<Node_D<int>>{tag});
+        for (int i = 0; i < 100; ++i)
+            li.PushBack(i);
+
+        const auto s = alloc_tracker::snapshot();
+        EXPECT_EQ(s.tags[tag].name, "Sallocator_List");
+        EXPECT_GE(s.tags[tag].allocations, 100);
+        EXPECT_GE(s.tags[tag].bytes_in_use, 100 * sizeof(Node_D<int>));
+    }
+    EXPECT_EQ(alloc_tracker::snapshot().tags[tag].bytes_in_use, 0);
+}
+
+TEST(Sallocator_Mallocator, base)
+{
+    const auto before = alloc_tracker::snapshot();
+    {
+        Vector<int, Sallocator> v(10, 7);
+        EXPECT_EQ(v[9], 7);
+    }
+    Sallocator<int, Mallocator> m;
+    m.Deallocate(m.Allocate(3), 3);
+    EXPECT_EQ(alloc_tracker::snapshot().bytes_in_use, before.bytes_in_use);
+}
+
+RDT_END
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "AllocatorTraits.hpp"
+#include "List.hpp"
+#include "Tallocator.hpp"
+#include "RDT_CoreDefs.h"
+
+RDT_BEGIN
+
+using namespace rds;
+
+TEST(Tallocator_Allocate, array)
+{
+    double* ptr = Tallocator<double>().Allocate(100);
+    Tallocator<double>().Construct(ptr, 100, 1.5);
+    EXPECT_EQ(ptr[99], 1.5);
+    Tallocator<double>().Deconstruct(ptr, 100);
+    Tallocator<double>().Deallocate(ptr, 100);
+
+    // 크기 등급보다 큰 할당은 전역 할당자로 넘어간다.
+    double* large = Tallocator<double>().Allocate(10000);
+    Tallocator<double>().Deallocate(large, 10000);
+}
+
+TEST(Tallocator_List, threads)
+{
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([] {
+            List<int, Tallocator> li;
+            for (int i = 0; i < 10000; ++i)
+                li.PushBack(i);
+            EXPECT_EQ(li.Size(), 10000);
+        });
+    }
+    for (auto& t: threads)
+        t.join();
+}
+
+RDT_END
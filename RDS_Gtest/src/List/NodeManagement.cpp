@@ -34,22 +34,22 @@ TEST(NodeManagement, CreateNode__const_Value_t_ref)
 {
     const int node_val = 99;
     { // Nallocator
-        auto* node_ptr = List<int, Nallocator>::CreateNode(node_val);
+        auto* node_ptr = List<int, Nallocator>().CreateNode(node_val);
 
         EXPECT_EQ(node_ptr->val, node_val);
         EXPECT_EQ(node_ptr->next, nullptr);
         EXPECT_EQ(node_ptr->prev, nullptr);
 
-        List<int, Nallocator>::DeleteNode(node_ptr);
+        List<int, Nallocator>().DeleteNode(node_ptr);
     }
     { // Mallocator
-        auto* node_ptr = List<int, Mallocator>::CreateNode(node_val);
+        auto* node_ptr = List<int, Mallocator>().CreateNode(node_val);
 
         EXPECT_EQ(node_ptr->val, node_val);
         EXPECT_EQ(node_ptr->next, nullptr);
         EXPECT_EQ(node_ptr->prev, nullptr);
 
-        List<int, Mallocator>::DeleteNode(node_ptr);
+        List<int, Mallocator>().DeleteNode(node_ptr);
     }
 }
 
@@ -62,38 +62,38 @@ TEST(NodeManagement, CreateNode__CtorArgs_t_ref_ref)
 
     { // Nallocator
         {
-            auto* dnode_0_ptr = List<DummyType, Nallocator>::CreateNode();
+            auto* dnode_0_ptr = List<DummyType, Nallocator>().CreateNode();
             EXPECT_EQ(dnode_0_ptr->val, d_0);
-            List<DummyType, Nallocator>::DeleteNode(dnode_0_ptr);
+            List<DummyType, Nallocator>().DeleteNode(dnode_0_ptr);
         }
         {
-            auto* dnode_1_ptr = List<DummyType, Nallocator>::CreateNode(d_1.a);
+            auto* dnode_1_ptr = List<DummyType, Nallocator>().CreateNode(d_1.a);
             EXPECT_EQ(dnode_1_ptr->val, d_1);
-            List<DummyType, Nallocator>::DeleteNode(dnode_1_ptr);
+            List<DummyType, Nallocator>().DeleteNode(dnode_1_ptr);
         }
         {
             auto* dnode_2_ptr =
-                List<DummyType, Nallocator>::CreateNode(d_2.a, d_2.b);
+                List<DummyType, Nallocator>().CreateNode(d_2.a, d_2.b);
             EXPECT_EQ(dnode_2_ptr->val, d_2);
-            List<DummyType, Nallocator>::DeleteNode(dnode_2_ptr);
+            List<DummyType, Nallocator>().DeleteNode(dnode_2_ptr);
         }
     }
     { // Mallocator
         {
-            auto* dnode_0_ptr = List<DummyType, Mallocator>::CreateNode();
+            auto* dnode_0_ptr = List<DummyType, Mallocator>().CreateNode();
             EXPECT_EQ(dnode_0_ptr->val, d_0);
-            List<DummyType, Mallocator>::DeleteNode(dnode_0_ptr);
+            List<DummyType, Mallocator>().DeleteNode(dnode_0_ptr);
         }
         {
-            auto* dnode_1_ptr = List<DummyType, Mallocator>::CreateNode(d_1.a);
+            auto* dnode_1_ptr = List<DummyType, Mallocator>().CreateNode(d_1.a);
             EXPECT_EQ(dnode_1_ptr->val, d_1);
-            List<DummyType, Mallocator>::DeleteNode(dnode_1_ptr);
+            List<DummyType, Mallocator>().DeleteNode(dnode_1_ptr);
         }
         {
             auto* dnode_2_ptr =
-                List<DummyType, Mallocator>::CreateNode(d_2.a, d_2.b);
+                List<DummyType, Mallocator>().CreateNode(d_2.a, d_2.b);
             EXPECT_EQ(dnode_2_ptr->val, d_2);
-            List<DummyType, Mallocator>::DeleteNode(dnode_2_ptr);
+            List<DummyType, Mallocator>().DeleteNode(dnode_2_ptr);
         }
     }
 }
@@ -0,0 +1,70 @@
+/// @file Assign.cpp
+
+#include "RDT_CoreDefs.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "Vector.hpp"
+
+RDT_BEGIN
+
+using namespace rds;
+
+TEST(Vector_Assign, construct_forwards_rvalue)
+{
+    // 원소 형식의 우변값 하나는 복사하지 않고 이동해야 한다. (이동 전용 형식도 생성할 수 있어야 한다)
+    using Traits_t = AllocatorTraits<Mallocator<std::unique_ptr<int>>>;
+    Mallocator<std::unique_ptr<int>> alloc;
+    auto* ptr = Traits_t::Allocate(alloc, 1);
+    auto  src = std::make_unique<int>(7);
+    Traits_t::Construct(alloc, ptr, 1, std::move(src));
+    EXPECT_EQ(src, nullptr);
+    EXPECT_EQ(*ptr[0], 7);
+    Traits_t::Deconstruct(alloc, ptr, 1);
+    Traits_t::Deallocate(alloc, ptr, 1);
+
+    // 좌변값은 개수만큼 복사한다.
+    const std::string val(40, 'x');
+    Mallocator<std::string> salloc;
+    auto* sptr = AllocatorTraits<Mallocator<std::string>>::Allocate(salloc, 3);
+    AllocatorTraits<Mallocator<std::string>>::Construct(salloc, sptr, 3, val);
+    EXPECT_EQ(sptr[2], val);
+    AllocatorTraits<Mallocator<std::string>>::Deconstruct(salloc, sptr, 3);
+    AllocatorTraits<Mallocator<std::string>>::Deallocate(salloc, sptr, 3);
+}
+
+TEST(Vector_Assign, count_val_trivial)
+{
+    Vector<int> vec(3, 1);
+    vec.Assign(1000, 0x01020304);
+    EXPECT_EQ(vec.Size(), 1000);
+    EXPECT_GE(vec.Capacity(), 1000);
+    for (int i = 0; i < vec.Size(); ++i)
+        EXPECT_EQ(vec[i], 0x01020304);
+
+    // 용량이 충분하면 메모리를 재사용한다.
+    const int* before = &vec[0];
+    vec.Assign(10, -1);
+    EXPECT_EQ(vec.Size(), 10);
+    EXPECT_EQ(&vec[0], before);
+    EXPECT_EQ(vec[9], -1);
+}
+
+TEST(Vector_Assign, count_val_non_trivial)
+{
+    Vector<std::string> vec(2, "a");
+    vec.Assign(100, std::string(40, 'x'));
+    EXPECT_EQ(vec.Size(), 100);
+    EXPECT_EQ(vec[99], std::string(40, 'x'));
+}
+
+TEST(Vector_Assign, init_list)
+{
+    Vector<std::string> vec;
+    vec.Assign({"one", "two", "three"});
+    EXPECT_EQ(vec.Size(), 3);
+    EXPECT_EQ(vec[2], "three");
+}
+
+RDT_END
@@ -0,0 +1,96 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <RDS/array.h>
+#include <RDS/vector.h>
+#include <RDS/Old/Algorithm.hpp>
+
+namespace {
+
+volatile std::size_t g_sink = 0;
+
+/// @brief \p f 를 \p rounds 번 실행한 가장 빠른 시간(원소당 ns)
+template <class F>
+double best_of(std::size_t n, int rounds, F&& f) {
+	using clock = std::chrono::steady_clock;
+	double best = 0.0;
+	for (int r = 0; r < rounds; ++r) {
+		const auto begin = clock::now();
+		f();
+		const double ns = std::chrono::duration<double, std::nano>(clock::now() - begin).count() / n;
+		if (r == 0 || ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+/// @brief 원소를 하나씩 비교하는 기준 구현
+template <class It, class T>
+std::size_t scalar_count(It first, It last, const T& val) {
+	std::size_t c = 0;
+	for (; first != last; ++first)
+		c += *first == val;
+	return c;
+}
+
+template <class It, class T>
+It scalar_find(It first, It last, const T& val) {
+	for (; first != last; ++first)
+		if (*first == val)
+			break;
+	return first;
+}
+
+/// @brief \p c 의 원소로 find/count/min/max 를 스칼라 구현과 SIMD 구현으로 측정한다.
+template <class Container>
+void bench(const char* name, Container& c, std::size_t n, int rounds) {
+	using T = std::remove_cvref_t<decltype(*c.begin())>;
+	const T missing = T(-1000); // 찾지 못해서 끝까지 훑는 경우
+
+	const double find_scalar = best_of(n, rounds, [&] { g_sink = scalar_find(c.begin(), c.end(), missing) - c.begin(); });
+	const double find_simd = best_of(n, rounds, [&] { g_sink = rds::Find(c.begin(), c.end(), missing) - c.begin(); });
+	const double count_scalar = best_of(n, rounds, [&] { g_sink = scalar_count(c.begin(), c.end(), T(7)); });
+	const double count_simd = best_of(n, rounds, [&] { g_sink = rds::Count(c.begin(), c.end(), T(7)); });
+	const double min_scalar = best_of(n, rounds, [&] { g_sink = rds::CompareElement(c.begin(), c.end(), rds::Less<T>()) - c.begin(); });
+	const double min_simd = best_of(n, rounds, [&] { g_sink = rds::MinElement(c.begin(), c.end()) - c.begin(); });
+	const double max_scalar = best_of(n, rounds, [&] { g_sink = rds::CompareElement(c.begin(), c.end(), rds::Greater<T>()) - c.begin(); });
+	const double max_simd = best_of(n, rounds, [&] { g_sink = rds::MaxElement(c.begin(), c.end()) - c.begin(); });
+
+	std::printf("%-22s find %6.3f -> %6.3f | count %6.3f -> %6.3f | min %6.3f -> %6.3f | max %6.3f -> %6.3f ns/elem\n", name,
+		find_scalar, find_simd, count_scalar, count_simd, min_scalar, min_simd, max_scalar, max_simd);
+}
+
+template <class T>
+void bench_vector(const char* name, std::size_t n) {
+	std::mt19937 rng(1);
+	rds::vector<T> v;
+	v.reserve(n);
+	for (std::size_t i = 0; i < n; ++i)
+		v.push_back(static_cast<T>(rng() % 1000));
+	bench(name, v, n, 10);
+}
+
+template <class T>
+void bench_array(const char* name) {
+	constexpr std::size_t n = 4096; // L1 에 들어가는 크기
+	static rds::array<T, n> a;
+	std::mt19937 rng(2);
+	for (auto& e: a)
+		e = static_cast<T>(rng() % 1000);
+	bench(name, a, n, 2000);
+}
+
+} // namespace
+
+int main() {
+	std::printf("AVX2 %s (scalar -> simd)\n", rds::simd::HasAvx2() ? "available" : "unavailable, using SSE2");
+	constexpr std::size_t n = 1 << 20;
+	bench_vector<std::int32_t>("vector<int32_t>", n);
+	bench_vector<float>("vector<float>", n);
+	bench_vector<double>("vector<double>", n);
+	bench_array<std::int32_t>("array<int32_t, 4096>");
+	bench_array<float>("array<float, 4096>");
+	bench_array<double>("array<double, 4096>");
+}
@@ -0,0 +1,126 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <RDS/aligned_allocator.h>
+#include <RDS/allocator.h>
+#include <RDS/vector.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+volatile std::uint64_t g_sink;
+
+/// @brief dTLB 읽기 미스 카운터. perf_event_open 을 쓸 수 없으면 -1 을 보고한다.
+class tlb_counter {
+public:
+	tlb_counter() {
+#if defined(__linux__)
+		perf_event_attr attr{};
+		attr.size = sizeof(attr);
+		attr.type = PERF_TYPE_HW_CACHE;
+		attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		fd_ = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+	}
+	~tlb_counter() {
+#if defined(__linux__)
+		if (fd_ >= 0)
+			::close(fd_);
+#endif
+	}
+	void start() {
+#if defined(__linux__)
+		if (fd_ >= 0) {
+			::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+			::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+	}
+	long long stop() {
+		long long v = -1;
+#if defined(__linux__)
+		if (fd_ >= 0) {
+			::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+			if (::read(fd_, &v, sizeof(v)) != sizeof(v))
+				v = -1;
+		}
+#endif
+		return v;
+	}
+private:
+	int fd_ = -1;
+};
+
+/// @brief 프로세스가 사용 중인 투명 대형 페이지의 크기 (KiB)
+long long anon_huge_kib() {
+	std::ifstream in("/proc/self/smaps_rollup");
+	std::string key;
+	long long kib;
+	while (in >> key) {
+		if (key == "AnonHugePages:" && in >> kib)
+			return kib;
+	}
+	return -1;
+}
+
+/// @brief 벡터를 채운 뒤 순차 합계의 처리량과, 무작위 위치 접근(페이지마다 TLB 항목이 필요)의 지연을 잰다.
+template <class Alloc>
+void bench(const char* name, std::size_t count) {
+	using clock = std::chrono::steady_clock;
+	rds::vector<std::uint64_t, Alloc> v;
+	v.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+		v.push_back(i * 0x9E3779B97F4A7C15ull);
+
+	tlb_counter tlb;
+
+	tlb.start();
+	auto begin = clock::now();
+	std::uint64_t sum = 0;
+	for (int pass = 0; pass < 4; ++pass)
+		for (std::size_t i = 0; i < count; ++i)
+			sum += v[i];
+	auto end = clock::now();
+	const long long seq_miss = tlb.stop();
+	const double seq_gbs = 4.0 * count * sizeof(std::uint64_t) / std::chrono::duration<double>(end - begin).count() / 1e9;
+
+	constexpr std::size_t probes = 20'000'000;
+	std::uint64_t x = 88172645463325252ull;
+	tlb.start();
+	begin = clock::now();
+	for (std::size_t i = 0; i < probes; ++i) {
+		x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+		sum += v[x % count];
+	}
+	end = clock::now();
+	const long long rnd_miss = tlb.stop();
+	const double rnd_ns = std::chrono::duration<double, std::nano>(end - begin).count() / probes;
+	g_sink = sum;
+
+	std::printf("%-28s seq %6.2f GB/s (dTLB miss %lld) | random %6.2f ns/access (dTLB miss %lld) | AnonHugePages %lld KiB\n",
+		name, seq_gbs, seq_miss, rnd_ns, rnd_miss, anon_huge_kib());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const std::size_t mib = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 512;
+	const std::size_t count = mib * 1024 * 1024 / sizeof(std::uint64_t);
+
+	std::printf("rds::vector<uint64_t> of %zu MiB\n", mib);
+	bench<rds::allocator<std::uint64_t>>("rds::allocator", count);
+	bench<rds::aligned_allocator<std::uint64_t, 64>>("rds::aligned_allocator<64>", count);
+	bench<rds::huge_page_allocator<std::uint64_t>>("rds::huge_page_allocator", count);
+}
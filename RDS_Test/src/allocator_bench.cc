@@ -0,0 +1,64 @@
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <RDS/allocator.h>
+#include <RDS/thread_cache.h>
+
+namespace {
+
+struct obj64 {
+	std::byte payload[64];
+};
+
+/// @brief 스레드마다 최근 할당된 객체 \p window 개를 유지하면서 할당/해제를 반복한다.
+/// @return 전체 처리량 (백만 op/s)
+template <class Alloc>
+double bench_threads(unsigned threads, std::size_t ops_per_thread) {
+	constexpr std::size_t window = 64;
+	auto work = [=] {
+		Alloc a;
+		obj64* live[window] = {};
+		for (std::size_t i = 0; i < ops_per_thread; ++i) {
+			auto& slot = live[i % window];
+			if (slot)
+				a.deallocate(slot, 1);
+			slot = a.allocate(1);
+			slot->payload[0] = std::byte(i);
+		}
+		for (auto* p: live)
+			if (p)
+				a.deallocate(p, 1);
+	};
+
+	const auto begin = std::chrono::steady_clock::now();
+	std::vector<std::thread> pool;
+	for (unsigned t = 0; t < threads; ++t)
+		pool.emplace_back(work);
+	for (auto& t: pool)
+		t.join();
+	const auto end = std::chrono::steady_clock::now();
+
+	const double sec = std::chrono::duration<double>(end - begin).count();
+	return threads * ops_per_thread / sec / 1e6;
+}
+
+} // namespace
+
+int main() {
+	constexpr std::size_t ops = 2'000'000;
+	const unsigned max_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+
+	std::printf("alloc+free of 64-byte objects, %zu ops/thread\n", ops);
+	std::vector<unsigned> counts;
+	for (unsigned t = 1; t < max_threads; t *= 2)
+		counts.push_back(t);
+	counts.push_back(max_threads);
+
+	for (unsigned t: counts) {
+		std::printf("threads=%-3u rds::allocator %8.2f Mops/s | rds::thread_cache_allocator %8.2f Mops/s\n", t,
+			bench_threads<rds::allocator<obj64>>(t, ops),
+			bench_threads<rds::thread_cache_allocator<obj64>>(t, ops));
+	}
+}
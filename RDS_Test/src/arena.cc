@@ -0,0 +1,39 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <RDS/arena.h>
+#include <RDS/vector.h>
+
+int main() {
+	rds::arena scratch;
+	{
+		rds::vector<int, rds::arena_allocator<int>> v{rds::arena_allocator<int>(scratch)};
+		for (int i = 0; i < 1000; ++i)
+			v.push_back(i);
+
+		rds::vector<std::string, rds::arena_allocator<std::string>> s{rds::arena_allocator<std::string>(scratch)};
+		s.emplace_back("per-request scratch");
+	}
+	scratch.release(); // 개별 해제 없이 한 번에 반환
+
+	alignas(std::max_align_t) unsigned char buf[256];
+	rds::arena local(buf, sizeof(buf));
+	local.allocate(64, 64);
+	local.allocate(1024); // 버퍼가 모자라면 상위 할당자로
+
+	// 청크 끝 근처에서 큰 정렬을 요청하면 새 청크에서 잘라야 한다.
+	rds::arena small(64);
+	small.allocate(1, 1);
+	void* p = small.allocate(8, 256);
+	assert(reinterpret_cast<std::uintptr_t>(p) % 256 == 0 && small.chunk_count() == 2);
+	std::memset(p, 0, 8);
+
+	alignas(64) unsigned char tail[64];
+	rds::arena edge(tail, sizeof(tail));
+	edge.allocate(40, 1);
+	void* q = edge.allocate(16, 64); // 정렬하면 버퍼 끝을 넘는다.
+	assert(reinterpret_cast<std::uintptr_t>(q) % 64 == 0 && edge.chunk_count() == 1);
+	assert(!(q >= static_cast<void*>(tail) && q < static_cast<void*>(tail + sizeof(tail))));
+	std::memset(q, 0, 16);
+}
@@ -0,0 +1,58 @@
+#include <cassert>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <RDS/bit_vector.h>
+
+int main() {
+	rds::bit_vector<> v;
+	std::vector<bool> ref;
+	std::mt19937_64 rng(42);
+	for (std::size_t i = 0; i < 300000; ++i) {
+		// 구간마다 밀도를 바꿔서 희소한 블록과 빽빽한 블록을 모두 만든다.
+		const bool b = (i / 50000) % 2 ? rng() % 100 == 0 : rng() % 3 != 0;
+		v.push_back(b);
+		ref.push_back(b);
+	}
+	v.build_index();
+
+	std::size_t ones = 0;
+	for (std::size_t i = 0; i <= v.size(); ++i) {
+		assert(v.rank(i) == ones);
+		if (i < v.size() && ref[i]) {
+			assert(v.select(ones) == i);
+			++ones;
+		}
+	}
+	assert(v.count() == ones && v.rank0(v.size()) == v.size() - ones);
+
+	rds::bit_vector<> all(1000, true);
+	assert(all.count() == 1000);
+	all.resize(1500, false);
+	all.resize(2000, true);
+	assert(all.count() == 1500 && !all[1200] && all[1999]);
+	all.build_index();
+	assert(all.select(999) == 999 && all.select(1000) == 1500 && all.rank(1600) == 1100);
+
+	rds::bit_vector<> even(2000);
+	for (std::size_t i = 0; i < 2000; i += 2)
+		even.set(i);
+	auto x = all;
+	x &= even;
+	assert(x.count() == 750);
+	x = all;
+	x |= even;
+	assert(x.count() == 1750);
+	x ^= even;
+	assert(x.count() == 750 && !x[0] && x[1]);
+	x.flip();
+	assert(x.count() == 1250 && x[0] && !x[1]); // 크기를 넘는 비트는 세지 않는다.
+	x.flip(0);
+	x.reset(2);
+	assert(!x[0] && !x[2] && x.count() == 1248);
+
+	x.resize(70);
+	x.pop_back();
+	assert(x.size() == 69 && x.word_count() == 2);
+	assert(x == x && !(x == even));
+}
@@ -0,0 +1,79 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <RDS/bit_vector.h>
+
+namespace {
+
+volatile std::size_t g_sink = 0;
+
+/// @brief \p f 를 한 번 실행한 시간(ns)을 \p n 으로 나눈 값
+template <class F>
+double per_op(std::size_t n, F&& f) {
+	using clock = std::chrono::steady_clock;
+	const auto begin = clock::now();
+	f();
+	return std::chrono::duration<double, std::nano>(clock::now() - begin).count() / n;
+}
+
+} // namespace
+
+int main() {
+	constexpr std::size_t bits = std::size_t{1} << 28;
+	constexpr std::size_t queries = 4'000'000;
+
+	std::mt19937_64 rng(7);
+	rds::bit_vector<> v(bits);
+	std::vector<bool> ref(bits);
+	for (std::size_t i = 0; i < bits; ++i) {
+		if (rng() % 4 == 0) {
+			v.set(i);
+			ref[i] = true;
+		}
+	}
+	const std::size_t data_bytes = v.word_count() * 8;
+	v.build_index();
+	std::printf("%zu bits, %zu ones, index overhead %.2f%%\n", bits, v.count(),
+		100.0 * (v.memory_usage() - data_bytes) / data_bytes);
+
+	std::printf("count             bit_vector %7.3f ns/word | std::vector<bool> %7.3f ns/word\n",
+		per_op(bits / 64, [&] { g_sink = v.count(); }),
+		per_op(bits / 64, [&] {
+			std::size_t c = 0;
+			for (bool b: ref)
+				c += b;
+			g_sink = c;
+		}));
+
+	std::vector<std::size_t> pos(queries);
+	for (auto& p: pos)
+		p = rng() % bits;
+	std::printf("random rank       bit_vector %7.3f ns/op\n", per_op(queries, [&] {
+		std::size_t s = 0;
+		for (std::size_t p: pos)
+			s += v.rank(p);
+		g_sink = s;
+	}));
+	const std::size_t ones = v.count();
+	std::printf("random select     bit_vector %7.3f ns/op\n", per_op(queries, [&] {
+		std::size_t s = 0;
+		for (std::size_t p: pos)
+			s += v.select(p % ones);
+		g_sink = s;
+	}));
+	std::printf("random membership bit_vector %7.3f ns/op | std::vector<bool> %7.3f ns/op\n",
+		per_op(queries, [&] {
+			std::size_t s = 0;
+			for (std::size_t p: pos)
+				s += v[p];
+			g_sink = s;
+		}),
+		per_op(queries, [&] {
+			std::size_t s = 0;
+			for (std::size_t p: pos)
+				s += ref[p];
+			g_sink = s;
+		}));
+}
@@ -0,0 +1,54 @@
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+#include <RDS/concurrent_vector.h>
+
+int main() {
+	constexpr int producers = 4, per_thread = 50000;
+	rds::concurrent_vector<std::string> v;
+	std::atomic<bool> done{false};
+
+	// 생산자가 추가하는 동안 읽는 스레드는 표시된 원소만 읽는다.
+	std::thread reader([&] {
+		std::size_t seen = 0;
+		while (!done.load(std::memory_order_acquire)) {
+			seen = 0;
+			v.for_each_published([&](std::size_t, const std::string& s) {
+				assert(s.size() == 8);
+				++seen;
+			});
+		}
+		(void)seen;
+	});
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < producers; ++t) {
+		threads.emplace_back([&v, t] {
+			for (int i = 0; i < per_thread; ++i) {
+				const std::size_t at = v.push_back(std::string(8, char('a' + t)));
+				const std::string* p = &v[at];
+				assert(v.published(at) && p->front() == char('a' + t));
+			}
+		});
+	}
+	for (auto& t: threads)
+		t.join();
+	done.store(true, std::memory_order_release);
+	reader.join();
+
+	assert(v.size() == producers * per_thread);
+	int count[producers] = {};
+	for (std::size_t i = 0; i < v.size(); ++i)
+		++count[v[i].front() - 'a'];
+	for (int c: count)
+		assert(c == per_thread);
+
+	rds::concurrent_vector<int, 128> w;
+	w.reserve(1000);
+	const int* first = &w[w.push_back(7)];
+	for (int i = 0; i < 100000; ++i)
+		w.push_back(i);
+	assert(&w[0] == first && w[100000] == 99999); // 세그먼트는 옮겨지지 않는다.
+}
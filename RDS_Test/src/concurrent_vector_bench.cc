@@ -0,0 +1,65 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <RDS/concurrent_vector.h>
+#include <RDS/vector.h>
+
+namespace {
+
+struct event {
+	std::uint64_t timestamp;
+	std::uint32_t thread;
+	std::uint32_t seq;
+};
+
+/// @brief \ref rds::vector 를 잠금으로 보호하는 비교 대상
+class locked_vector {
+public:
+	void push_back(const event& e) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		v_.push_back(e);
+	}
+private:
+	std::mutex mutex_;
+	rds::vector<event> v_;
+};
+
+/// @brief \p producers 개의 스레드가 각각 \p per_thread 개의 이벤트를 추가하는 처리량(백만 op/s)
+template <class Vec>
+double bench(unsigned producers, std::size_t per_thread) {
+	Vec v;
+	const auto begin = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for (unsigned t = 0; t < producers; ++t) {
+		threads.emplace_back([&v, t, per_thread] {
+			for (std::size_t i = 0; i < per_thread; ++i)
+				v.push_back(event{i * 1000, t, static_cast<std::uint32_t>(i)});
+		});
+	}
+	for (auto& t: threads)
+		t.join();
+	const auto end = std::chrono::steady_clock::now();
+	return producers * per_thread / std::chrono::duration<double>(end - begin).count() / 1e6;
+}
+
+} // namespace
+
+int main() {
+	constexpr std::size_t total = 8'000'000;
+	const unsigned max_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+
+	std::vector<unsigned> counts;
+	for (unsigned t = 1; t < max_threads; t *= 2)
+		counts.push_back(t);
+	counts.push_back(max_threads);
+
+	std::printf("%zu events of %zu bytes in total\n", total, sizeof(event));
+	for (unsigned t: counts) {
+		std::printf("producers=%-3u mutex + rds::vector %8.2f Mops/s | rds::concurrent_vector %8.2f Mops/s\n", t,
+			bench<locked_vector>(t, total / t),
+			bench<rds::concurrent_vector<event>>(t, total / t));
+	}
+}
@@ -0,0 +1,275 @@
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <set>
+#include <random>
+#include <vector>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <RDS/aligned_allocator.h>
+#include <RDS/heap.h>
+#include <RDS/memory_resource.h>
+
+namespace {
+
+/// @brief 모든 원소를 꺼내면서 힙 속성대로 나오는지 확인한다.
+template <class H, class Cmp>
+void drain_sorted(H& h, std::size_t n, Cmp cmp) {
+	assert(h.size() == n);
+	auto prev = h.extract();
+	for (std::size_t i = 1; i < n; ++i) {
+		auto const cur = h.extract();
+		assert(!cmp(cur, prev));
+		prev = cur;
+	}
+	assert(h.empty());
+}
+
+/// @brief 가리키는 값으로 비교하는 힙 속성
+struct deref_less {
+	template <class P>
+	bool operator()(P const& l, P const& r) const {
+		return *l < *r;
+	}
+};
+
+/// @brief id 가 다르면 서로 다르다고 비교되고, 이동하면 원본의 id 를 비우는 전파 할당자
+template <class T>
+struct moving_allocator {
+	using value_type = T;
+	using propagate_on_container_move_assignment = std::true_type;
+	template <class U>
+	struct rebind {
+		using other = moving_allocator<U>;
+	};
+
+	int id = 0;
+
+	moving_allocator() = default;
+	explicit moving_allocator(int i): id(i) {}
+	template <class U>
+	moving_allocator(moving_allocator<U> const& o): id(o.id) {}
+	moving_allocator(moving_allocator const&) = default;
+	moving_allocator(moving_allocator&& o) noexcept: id(std::exchange(o.id, -1)) {}
+	moving_allocator& operator=(moving_allocator const&) = default;
+	moving_allocator& operator=(moving_allocator&& o) noexcept {
+		id = std::exchange(o.id, -1);
+		return *this;
+	}
+
+	T* allocate(std::size_t n) {
+		return std::allocator<T>().allocate(n);
+	}
+	void deallocate(T* p, std::size_t n) {
+		std::allocator<T>().deallocate(p, n);
+	}
+	template <class U>
+	bool operator==(moving_allocator<U> const& o) const {
+		return id == o.id;
+	}
+};
+
+/// @brief 자식 수가 \p H::arity 인 힙에 무작위 원소를 넣고 꺼내면서 확인한다.
+template <class H, class Cmp, class Gen>
+void check_arity(Cmp cmp, Gen gen) {
+	using T = std::remove_cvref_t<decltype(gen())>;
+	std::vector<T, typename H::allocator_type> src;
+	for (int i = 0; i < 5000; ++i)
+		src.push_back(gen());
+	H copied(src);
+	drain_sorted(copied, src.size(), cmp);
+	H h;
+	for (std::size_t i = 0; i < 1000; ++i)
+		h.insert(src[i]);
+	h.insert_range(src);
+	assert(h.del(src[10]) && h.size() == src.size() + 999);
+	drain_sorted(h, src.size() + 999, cmp);
+}
+
+} // namespace
+
+int main() {
+	std::mt19937 rng(42);
+	std::vector<int> src(10000);
+	for (auto& e: src)
+		e = static_cast<int>(rng() % 1000);
+
+	rds::Heap<int> copied(src);
+	assert(copied.size() == src.size() && src.size() == 10000);
+	drain_sorted(copied, src.size(), std::greater<int>());
+
+	auto buf = src;
+	rds::Heap<int, std::less<int>> moved(std::move(buf));
+	assert(buf.empty());
+	drain_sorted(moved, src.size(), std::less<int>());
+
+	// 작은 묶음은 하나씩 올리고, 큰 묶음은 다시 힙으로 만든다. 두 경로 모두 힙 속성을 지켜야 한다.
+	rds::Heap<int> h(src);
+	h.insert_range(std::vector<int>{5000, -1, 999});
+	assert(h.top() == 5000);
+	h.insert_range(src);
+	assert(h.size() == 2 * src.size() + 3);
+	drain_sorted(h, 2 * src.size() + 3, std::greater<int>());
+
+	// 맨 위를 바꾸는 연산은 한 번만 내려보내지만 결과는 꺼낸 뒤 넣은 것과 같아야 한다.
+	rds::Heap<std::string, std::less<std::string>> sh;
+	for (int i = 0; i < 200; ++i)
+		sh.insert(std::to_string(i * 7919 % 1000));
+	for (int i = 0; i < 200; ++i) {
+		auto const top = sh.top();
+		auto s = std::to_string(rng() % 1000);
+		auto const expect = s < top ? s : top;
+		assert((i % 2 ? sh.push_pop(std::move(s)) : sh.push_pop(s)) == expect);
+		assert(sh.replace_top("zzz" + std::to_string(i)) <= sh.top());
+	}
+	drain_sorted(sh, 200, std::less<std::string>());
+
+	rds::Heap<int> empty;
+	empty.insert_range(std::vector<int>{});
+	assert(empty.empty());
+	empty.insert_range(std::vector<int>{3, 1, 2});
+	assert(empty.push_pop(0) == 3 && empty.size() == 3);
+	assert(empty.del(2) && !empty.del(7));
+	assert(empty.extract() == 1 && empty.extract() == 0 && empty.empty());
+
+	// SIMD 로 자식을 고르는 경우와 하나씩 비교하는 경우, 자식 묶음이 잘린 마지막 단계를 모두 지난다.
+	auto gen_int = [&] { return static_cast<int>(rng() % 1000) - 500; };
+	auto gen_double = [&] { return static_cast<double>(rng() % 1000) / 7; };
+	auto gen_string = [&] { return std::to_string(rng() % 1000); };
+	check_arity<rds::Heap<int, std::less<int>, 4>>(std::less<int>(), gen_int);
+	check_arity<rds::Heap<int, std::greater<int>, 8, rds::aligned_allocator<int>>>(std::greater<int>(), gen_int);
+	check_arity<rds::Heap<float, std::less<float>, 8>>(std::less<float>(), [&] { return static_cast<float>(gen_double()); });
+	check_arity<rds::Heap<double, std::greater<>, 4>>(std::greater<double>(), gen_double);
+	check_arity<rds::Heap<std::string, std::less<std::string>, 4>>(std::less<std::string>(), gen_string);
+
+	// 핸들로 우선순위를 바꾸거나 지우면서, 남은 원소 중 가장 작은 값이 맨 위에 있는지 확인한다.
+	rds::IndexedHeap<int, std::less<int>> ih;
+	std::map<std::size_t, int> live;
+	for (int step = 0; step < 10000; ++step) {
+		auto const op = rng() % 4;
+		if (op < 2 || live.empty()) {
+			auto const v = static_cast<int>(rng() % 100000);
+			auto const h = ih.insert(v);
+			assert(!live.count(h));
+			live[h] = v;
+		} else {
+			auto it = live.begin();
+			std::advance(it, rng() % live.size());
+			if (op == 2) {
+				auto const v = static_cast<int>(rng() % 100000);
+				bool const updated = ih.update(it->first, v);
+				assert(updated);
+				it->second = v;
+			} else {
+				assert(ih.erase(it->first) && !ih.contains(it->first) && !ih.erase(it->first));
+				assert(!ih.update(it->first, 0)); // 지운 핸들은 무시한다.
+				live.erase(it);
+			}
+		}
+		assert(ih.size() == live.size());
+		if (!live.empty()) {
+			auto min = live.begin();
+			for (auto it = live.begin(); it != live.end(); ++it)
+				if (it->second < min->second)
+					min = it;
+			assert(ih.top() == min->second && ih[ih.top_handle()] == min->second);
+		}
+		if (step % 1000 == 0) {
+			for (auto const& [h, v]: live)
+				assert(ih.contains(h) && ih[h] == v);
+		}
+	}
+	int prev = ih.extract();
+	while (!ih.empty()) {
+		auto const cur = ih.extract();
+		assert(prev <= cur);
+		prev = cur;
+	}
+
+	// 이동만 가능한 원소도 넣고 꺼낼 수 있다.
+	{
+		rds::IndexedHeap<std::unique_ptr<int>, deref_less> uh;
+		for (int i = 0; i < 100; ++i)
+			uh.insert(std::make_unique<int>((i * 37) % 100));
+		for (int i = 0; i < 100; ++i)
+			assert(*uh.extract() == i);
+	}
+
+	// 짝짓기 힙: 핸들로 우선순위를 올리거나 지우고, 다른 힙과 합치면서 참조 구현과 비교한다.
+	using pheap = rds::PairingHeap<int, std::less<int>, rds::polymorphic_allocator<int>>;
+	rds::unsynchronized_pool_resource pool_a, pool_b;
+	pheap ph{&pool_a};
+	std::multiset<int> ref;
+	std::vector<pheap::handle> handles;
+	for (int step = 0; step < 10000; ++step) {
+		auto const op = rng() % 8;
+		if (op < 3 || ref.empty()) {
+			auto const v = static_cast<int>(rng() % 100000);
+			handles.push_back(ph.insert(v));
+			ref.insert(v);
+		} else if (op == 3) {
+			auto const h = ph.top_handle();
+			assert(ph.extract() == *ref.begin());
+			ref.erase(ref.begin());
+			std::erase(handles, h);
+		} else if (op < 6 && !handles.empty()) {
+			auto& h = handles[rng() % handles.size()];
+			auto const old = ph[h];
+			auto const v = old - static_cast<int>(rng() % 1000);
+			ph.decrease_key(h, v);
+			ref.erase(ref.find(old));
+			ref.insert(v);
+		} else if (op == 6 && !handles.empty()) {
+			auto const i = rng() % handles.size();
+			ref.erase(ref.find(ph[handles[i]]));
+			ph.erase(handles[i]);
+			handles.erase(handles.begin() + static_cast<std::ptrdiff_t>(i));
+		} else {
+			// 같은 자원이면 핸들이 유지되고, 다른 자원이면 원소를 하나씩 옮긴다.
+			pheap other{op % 2 ? &pool_a : &pool_b};
+			std::vector<pheap::handle> moved;
+			for (int i = 0; i < 50; ++i) {
+				auto const v = static_cast<int>(rng() % 100000);
+				moved.push_back(other.insert(v));
+				ref.insert(v);
+			}
+			ph.meld(other);
+			assert(other.empty());
+			if (op % 2)
+				handles.insert(handles.end(), moved.begin(), moved.end());
+		}
+		assert(ph.size() == ref.size());
+		assert(ref.empty() || ph.top() == *ref.begin());
+	}
+	pheap moved_to(std::move(ph));
+	assert(ph.empty() && moved_to.size() == ref.size());
+	for (auto const v: ref)
+		assert(moved_to.extract() == v);
+	assert(moved_to.empty());
+
+	// 할당자를 전파하는 이동 대입은 옮겨진 원본 할당자와 비교하지 않고 노드를 그대로 넘겨받는다.
+	{
+		using mheap = rds::PairingHeap<int, std::less<int>, moving_allocator<int>>;
+		mheap src{moving_allocator<int>(1)}, dst{moving_allocator<int>(2)};
+		dst.insert(7);
+		std::vector<mheap::handle> hs;
+		for (int i = 0; i < 100; ++i)
+			hs.push_back(src.insert(i));
+		dst = std::move(src);
+		assert(src.empty() && dst.size() == 100 && dst.get_allocator().id == 1);
+		for (int i = 0; i < 100; ++i)
+			assert(dst[hs[static_cast<std::size_t>(i)]] == i);
+	}
+
+	// 남은 원소가 있는 채로 소멸해도 모든 노드를 해제해야 한다.
+	rds::PairingHeap<std::string> left;
+	for (int i = 0; i < 1000; ++i)
+		left.insert(std::to_string(i) + std::string(20, '.'));
+	for (int i = 0; i < 10; ++i)
+		left.extract();
+	assert(left.size() == 990);
+}
@@ -0,0 +1,262 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <RDS/aligned_allocator.h>
+#include <RDS/heap.h>
+
+namespace {
+
+volatile std::size_t g_sink = 0;
+
+/// @brief \p f 를 한 번 실행한 시간(ms)
+template <class F>
+double elapsed_ms(F&& f) {
+	using clock = std::chrono::steady_clock;
+	const auto begin = clock::now();
+	f();
+	return std::chrono::duration<double, std::milli>(clock::now() - begin).count();
+}
+
+/// @brief SIMD 경로를 타지 않도록 `std::less` 와 형식만 다르게 한 비교자
+struct scalar_less {
+	bool operator()(int a, int b) const {
+		return a < b;
+	}
+};
+
+/// @brief \p keys 로 힙을 만든 뒤 꺼내고 넣기를 반복하고, 마지막에 전부 꺼낸다.
+template <class H>
+void arity_row(const char* name, std::vector<int> const& keys) {
+	std::vector<int, typename H::allocator_type> buf(keys.begin(), keys.end());
+	H h;
+	const double build = elapsed_ms([&] {
+		h = H(std::move(buf));
+	});
+	std::size_t i = 0;
+	const double churn = elapsed_ms([&] {
+		for (; i < keys.size() / 2; ++i) {
+			g_sink = g_sink + static_cast<std::size_t>(h.extract());
+			h.insert(keys[i] ^ 0x5555);
+		}
+	});
+	const double drain = elapsed_ms([&] {
+		while (!h.empty())
+			g_sink = g_sink + static_cast<std::size_t>(h.extract());
+	});
+	std::printf("  %-28s build %7.2f ms | extract+insert %8.2f ms | drain %8.2f ms\n", name, build, churn, drain);
+}
+
+/// @brief 64바이트 POD 원소
+struct pod64 {
+	std::uint64_t key;
+	char payload[56];
+	bool operator<(pod64 const& o) const {
+		return key < o.key;
+	}
+};
+
+/// @brief 이동/복사 횟수를 세는 래퍼
+template <class P>
+struct counted {
+	static inline std::size_t moves = 0;
+	P v;
+	counted() = default;
+	counted(P p): v(std::move(p)) {}
+	counted(counted const& o): v(o.v) {
+		++moves;
+	}
+	counted(counted&& o) noexcept: v(std::move(o.v)) {
+		++moves;
+	}
+	counted& operator=(counted const& o) {
+		v = o.v;
+		++moves;
+		return *this;
+	}
+	counted& operator=(counted&& o) noexcept {
+		v = std::move(o.v);
+		++moves;
+		return *this;
+	}
+	bool operator<(counted const& o) const {
+		return v < o.v;
+	}
+};
+
+/// @brief 단계마다 `std::swap` 하는 재귀 sift 를 쓰던 이전 이진 힙 (비교용)
+template <class T>
+class swap_heap {
+public:
+	void insert(T v) {
+		vec_.push_back(std::move(v));
+		up(vec_.size() - 1);
+	}
+	T extract() {
+		auto ret = std::move(vec_.front());
+		vec_.front() = std::move(vec_.back());
+		vec_.pop_back();
+		down(0);
+		return ret;
+	}
+private:
+	void up(std::size_t c) {
+		if (c == 0)
+			return;
+		auto const p = (c - 1) / 2;
+		if (!(vec_[c] < vec_[p]))
+			return;
+		std::swap(vec_[c], vec_[p]);
+		up(p);
+	}
+	void down(std::size_t p) {
+		auto const l = 2 * p + 1;
+		if (!(l < vec_.size()))
+			return;
+		auto t = l;
+		if (l + 1 < vec_.size() && vec_[l + 1] < vec_[l])
+			t = l + 1;
+		if (!(vec_[t] < vec_[p]))
+			return;
+		std::swap(vec_[p], vec_[t]);
+		down(t);
+	}
+	std::vector<T> vec_;
+};
+
+/// @brief 힙을 채운 뒤 맨 위를 새 원소로 바꾸는 일을 반복한다. 이동 횟수와 연산당 시간을 출력한다.
+template <class P, class Make>
+void sift_rows(const char* name, Make make) {
+	constexpr std::size_t fill = 100'000;
+	constexpr std::size_t ops = 500'000;
+	std::vector<P> in(fill + ops);
+	for (std::size_t i = 0; i < in.size(); ++i)
+		in[i] = make(i);
+
+	auto run = [&]<class H>(H& h, auto&& step) {
+		for (std::size_t i = 0; i < fill; ++i)
+			h.insert(in[i]);
+		return elapsed_ms([&] {
+			for (std::size_t i = fill; i < in.size(); ++i)
+				step(h, in[i]);
+		}) * 1e6 / ops;
+	};
+	auto moves = [&]<class H>(H& h, auto&& step) {
+		for (std::size_t i = 0; i < fill; ++i)
+			h.insert(in[i]);
+		counted<P>::moves = 0;
+		for (std::size_t i = fill; i < in.size(); ++i)
+			step(h, counted<P>(in[i]));
+		return static_cast<double>(counted<P>::moves) / ops;
+	};
+	auto extract_insert = [](auto& h, auto v) {
+		auto const top = h.extract();
+		g_sink = g_sink + (top < v);
+		h.insert(std::move(v));
+	};
+	auto replace = [](auto& h, auto v) {
+		auto const top = h.replace_top(std::move(v));
+		g_sink = g_sink + (h.top() < top);
+	};
+
+	swap_heap<P> a;
+	swap_heap<counted<P>> ac;
+	rds::Heap<P, std::less<P>> b, c;
+	rds::Heap<counted<P>, std::less<counted<P>>> bc, cc;
+	std::printf("%s\n", name);
+	std::printf("  swap sift, extract+insert  %6.1f moves/op %8.1f ns/op\n", moves(ac, extract_insert), run(a, extract_insert));
+	std::printf("  hole sift, extract+insert  %6.1f moves/op %8.1f ns/op\n", moves(bc, extract_insert), run(b, extract_insert));
+	std::printf("  hole sift, replace_top     %6.1f moves/op %8.1f ns/op\n", moves(cc, replace), run(c, replace));
+}
+
+/// @brief 샤드별 큐를 주 큐에 합치는 일을 반복한다. \p meld_into 가 합치는 방법을 정한다.
+template <class H, class Meld>
+double meld_mix(std::vector<int> const& keys, std::size_t shards, std::size_t per_shard, std::size_t extract_per_round, Meld meld_into) {
+	constexpr std::size_t rounds = 200;
+	std::size_t k = 0;
+	auto next = [&] { return keys[k++ % keys.size()]; };
+	H main;
+	for (std::size_t i = 0; i < 100'000; ++i)
+		main.insert(next());
+	return elapsed_ms([&] {
+		for (std::size_t r = 0; r < rounds; ++r) {
+			for (std::size_t s = 0; s < shards; ++s) {
+				H shard;
+				for (std::size_t i = 0; i < per_shard; ++i)
+					shard.insert(next());
+				meld_into(main, shard);
+			}
+			for (std::size_t i = 0; i < extract_per_round && !main.empty(); ++i)
+				g_sink = g_sink + static_cast<std::size_t>(main.extract());
+		}
+	});
+}
+
+} // namespace
+
+int main() {
+	constexpr std::size_t n = 5'000'000;
+
+	std::mt19937_64 rng(7);
+	std::vector<std::size_t> snapshot(n);
+	for (auto& e: snapshot)
+		e = rng();
+
+	std::printf("rebuild from %zu-element snapshot\n", n);
+	std::printf("  insert one by one  %8.2f ms\n", elapsed_ms([&] {
+		rds::Heap<std::size_t> h;
+		for (auto e: snapshot)
+			h.insert(e);
+		g_sink = h.top();
+	}));
+	std::printf("  heapify (copy)     %8.2f ms\n", elapsed_ms([&] {
+		rds::Heap<std::size_t> h(snapshot);
+		g_sink = h.top();
+	}));
+	auto buf = snapshot;
+	std::printf("  heapify (move-in)  %8.2f ms\n", elapsed_ms([&] {
+		rds::Heap<std::size_t> h(std::move(buf));
+		g_sink = h.top();
+	}));
+	std::printf("  insert_range       %8.2f ms\n", elapsed_ms([&] {
+		rds::Heap<std::size_t> h;
+		h.insert_range(snapshot);
+		g_sink = h.top();
+	}));
+
+	std::vector<int> keys(n);
+	for (auto& e: keys)
+		e = static_cast<int>(rng());
+	std::printf("arity on %zu int keys (min-heap)\n", n);
+	using aligned = rds::aligned_allocator<int>;
+	arity_row<rds::Heap<int, std::less<int>, 2>>("2-ary", keys);
+	arity_row<rds::Heap<int, scalar_less, 4>>("4-ary scalar", keys);
+	arity_row<rds::Heap<int, std::less<int>, 4>>("4-ary simd", keys);
+	arity_row<rds::Heap<int, std::less<int>, 4, aligned>>("4-ary simd, 64B aligned", keys);
+	arity_row<rds::Heap<int, scalar_less, 8>>("8-ary scalar", keys);
+	arity_row<rds::Heap<int, std::less<int>, 8>>("8-ary simd", keys);
+	arity_row<rds::Heap<int, std::less<int>, 8, aligned>>("8-ary simd, 64B aligned", keys);
+
+	std::mt19937_64 prng(11);
+	sift_rows<std::string>("std::string (32 chars)", [&](std::size_t) { return std::to_string(prng()) + std::string(32 - 20, 'x'); });
+	sift_rows<pod64>("64-byte POD", [&](std::size_t) { return pod64{prng(), {}}; });
+
+	using binary = rds::Heap<int, std::less<int>>;
+	using pairing = rds::PairingHeap<int, std::less<int>>;
+	auto drain_into = [](binary& main, binary& shard) {
+		while (!shard.empty())
+			main.insert(shard.extract());
+	};
+	auto meld = [](pairing& main, pairing& shard) {
+		main.meld(shard);
+	};
+	std::printf("meld vs extract mixes, 200 rounds of 8 shards x 2048 events\n");
+	std::printf("  meld-heavy    (extract   256/round)  Heap %8.2f ms | PairingHeap %8.2f ms\n",
+		meld_mix<binary>(keys, 8, 2048, 256, drain_into), meld_mix<pairing>(keys, 8, 2048, 256, meld));
+	std::printf("  extract-heavy (extract 16384/round)  Heap %8.2f ms | PairingHeap %8.2f ms\n",
+		meld_mix<binary>(keys, 8, 2048, 16384, drain_into), meld_mix<pairing>(keys, 8, 2048, 16384, meld));
+}
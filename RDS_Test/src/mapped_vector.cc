@@ -0,0 +1,62 @@
+#include <cassert>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <RDS/mapped_vector.h>
+
+struct entry {
+	std::uint64_t key;
+	double value;
+};
+
+int main() {
+	const auto path = std::filesystem::temp_directory_path() / "rds_mapped_vector_test.bin";
+	std::filesystem::remove(path);
+
+	{
+		rds::mapped_vector<entry> w(path.c_str(), rds::map_mode::read_write);
+		assert(w.is_open() && w.empty());
+		for (std::uint64_t i = 0; i < 100000; ++i)
+			w.push_back({i, i * 0.5});
+		w.emplace_back(w.front()); // 다시 매핑되어도 자기 원소를 인자로 넘길 수 있다.
+		assert(w.size() == 100001 && w.back().key == 0);
+		w.pop_back();
+		w.sync();
+	}
+	// 닫을 때 파일은 원소 수에 맞게 줄어든다.
+	assert(std::filesystem::file_size(path) == 100000 * sizeof(entry));
+
+	rds::mapped_vector<entry> r(path.c_str());
+	assert(r.mode() == rds::map_mode::read_only && r.size() == 100000);
+	assert(r[4242].key == 4242 && r[4242].value == 2121.0);
+	std::uint64_t sum = 0;
+	for (const entry& e: r)
+		sum += e.key;
+	assert(sum == 99999ull * 100000 / 2);
+
+	// 같은 파일을 동시에 열 수 있다.
+	rds::mapped_vector<entry> r2(path.c_str());
+	assert(r2.data() != r.data() && r2[99999].key == 99999);
+
+	{
+		rds::mapped_vector<entry> w(path.c_str(), rds::map_mode::read_write);
+		w.resize(10);
+		w.resize(20, entry{7, 7.0});
+		w[0].value = -1.0;
+	}
+	rds::mapped_vector<entry> moved(std::move(r));
+	assert(!r.is_open() && moved.size() == 100000); // 기존 매핑은 열 때의 크기를 유지한다.
+	moved.open(path.c_str());
+	assert(moved.size() == 20 && moved[0].value == -1.0 && moved[15].key == 7);
+
+	std::filesystem::resize_file(path, 20 * sizeof(entry) + 1);
+	bool threw = false;
+	try {
+		rds::mapped_vector<entry> bad(path.c_str());
+	} catch (const std::system_error&) {
+		threw = true;
+	}
+	assert(threw);
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,71 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <RDS/mapped_vector.h>
+#include <RDS/vector.h>
+
+namespace {
+
+struct entry {
+	std::uint64_t key;
+	double value;
+};
+
+volatile double g_sink = 0;
+
+template <class F>
+double elapsed_ms(F&& f) {
+	using clock = std::chrono::steady_clock;
+	const auto begin = clock::now();
+	f();
+	return std::chrono::duration<double, std::milli>(clock::now() - begin).count();
+}
+
+} // namespace
+
+int main() {
+	constexpr std::size_t n = 16'000'000; // 256 MB
+	constexpr std::size_t lookups = 10'000;
+	const auto path = std::filesystem::temp_directory_path() / "rds_mapped_vector_bench.bin";
+
+	const double build = elapsed_ms([&] {
+		rds::mapped_vector<entry> w(path.c_str(), rds::map_mode::read_write);
+		w.reserve(n);
+		for (std::uint64_t i = 0; i < n; ++i)
+			w.push_back({i, i * 0.5});
+	});
+	std::printf("%zu entries (%zu MB), written through mapped_vector in %.1f ms\n", n, n * sizeof(entry) >> 20, build);
+
+	std::mt19937_64 rng(3);
+	rds::vector<std::size_t> keys;
+	for (std::size_t i = 0; i < lookups; ++i)
+		keys.push_back(rng() % n);
+
+	// 시작할 때마다 파일 전체를 읽어서 역직렬화하는 경우
+	const double load = elapsed_ms([&] {
+		rds::vector<entry> table;
+		std::FILE* f = std::fopen(path.c_str(), "rb");
+		table.reserve(n);
+		entry e;
+		while (std::fread(&e, sizeof(e), 1, f) == 1)
+			table.push_back(e);
+		std::fclose(f);
+		double s = 0;
+		for (std::size_t k: keys)
+			s += table[k].value;
+		g_sink = s;
+	});
+	// 매핑하고 필요한 페이지만 읽는 경우
+	const double map = elapsed_ms([&] {
+		rds::mapped_vector<entry> table(path.c_str());
+		double s = 0;
+		for (std::size_t k: keys)
+			s += table[k].value;
+		g_sink = s;
+	});
+	std::printf("open + %zu lookups  deserialize %8.2f ms | mapped_vector %8.2f ms\n", lookups, load, map);
+
+	std::filesystem::remove(path);
+}
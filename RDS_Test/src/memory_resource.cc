@@ -0,0 +1,64 @@
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <RDS/cbtree.h>
+#include <RDS/memory_resource.h>
+#include <RDS/vector.h>
+
+template <class T>
+using pvector = rds::vector<T, rds::polymorphic_allocator<T>>;
+
+/// @brief 자원만 바꿔서 같은 타입의 컨테이너를 사용한다.
+static void fill(pvector<std::string>& v) {
+	for (int i = 0; i < 1000; ++i)
+		v.emplace_back(std::to_string(i));
+}
+
+int main() {
+	rds::monotonic_buffer_resource request;
+	rds::unsynchronized_pool_resource pool;
+	{
+		pvector<std::string> a{&request};
+		pvector<std::string> b{&pool};
+		pvector<std::string> c; // 기본 자원
+		fill(a), fill(b), fill(c);
+		assert(a[999] == "999" && b[999] == "999" && c[999] == "999");
+
+		pvector<std::string> copy(a);
+		assert(copy.get_allocator().resource() == rds::get_default_resource());
+	}
+	request.release();
+
+	// 블록은 요청한 정렬을 만족해야 한다.
+	for (std::size_t align = 8; align <= 256; align *= 2) {
+		void* p = pool.allocate(align, align);
+		assert(reinterpret_cast<std::uintptr_t>(p) % align == 0);
+		pool.deallocate(p, align, align);
+	}
+	void* large = pool.allocate(1 << 20);
+	pool.deallocate(large, 1 << 20);
+
+	rds::cbtree<int, rds::polymorphic_allocator<int>> tree(4, 9, true, &pool);
+	assert(tree.size() == 31);
+
+	rds::synchronized_pool_resource shared;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&shared] {
+			pvector<int> v{&shared};
+			for (int i = 0; i < 10000; ++i)
+				v.push_back(i);
+		});
+	}
+	for (auto& t: threads)
+		t.join();
+
+	rds::monotonic_buffer_resource scoped;
+	auto* prev = rds::set_default_resource(&scoped);
+	pvector<int> d;
+	d.push_back(1);
+	assert(d.get_allocator().resource() == &scoped);
+	rds::set_default_resource(prev);
+}
@@ -0,0 +1,109 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <RDS/allocator.h>
+#include <RDS/memory_resource.h>
+#include <RDS/vector.h>
+
+namespace {
+
+volatile std::size_t g_sink;
+
+struct obj64 {
+	std::byte payload[64];
+};
+
+template <class F>
+double ns_per_op(std::size_t ops, F&& f) {
+	const auto begin = std::chrono::steady_clock::now();
+	f();
+	const auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - begin).count() / ops;
+}
+
+/// @brief 요청마다 작은 벡터 여러 개를 만들어 채우고 버리는 작업. \p reset 은 요청이 끝날 때 호출된다.
+template <class Vec, class Make, class Reset>
+double request_scoped(Make make, Reset reset) {
+	constexpr std::size_t requests = 20'000, vectors = 16, elems = 64;
+	return ns_per_op(requests * vectors, [&] {
+		for (std::size_t r = 0; r < requests; ++r) {
+			{
+				std::size_t sum = 0;
+				for (std::size_t v = 0; v < vectors; ++v) {
+					Vec vec = make();
+					for (std::size_t i = 0; i < elems; ++i)
+						vec.push_back(static_cast<int>(i));
+					sum += vec.size();
+				}
+				g_sink = sum;
+			}
+			reset();
+		}
+	});
+}
+
+/// @brief 최근 할당한 객체 \p window 개를 유지하면서 64 바이트 객체를 할당/해제한다. (노드 컨테이너와 비슷한 패턴)
+template <class Alloc>
+double churn(Alloc a, std::size_t ops) {
+	constexpr std::size_t window = 256;
+	return ns_per_op(ops, [&] {
+		obj64* live[window] = {};
+		for (std::size_t i = 0; i < ops; ++i) {
+			auto& slot = live[(i * 7) % window];
+			if (slot)
+				a.deallocate(slot, 1);
+			slot = a.allocate(1);
+			slot->payload[0] = std::byte(i);
+		}
+		for (auto* p: live)
+			if (p)
+				a.deallocate(p, 1);
+	});
+}
+
+template <class Alloc>
+double churn_threads(Alloc a, unsigned threads, std::size_t ops) {
+	const auto begin = std::chrono::steady_clock::now();
+	std::vector<std::thread> pool;
+	for (unsigned t = 0; t < threads; ++t)
+		pool.emplace_back([=] { churn(a, ops); });
+	for (auto& t: pool)
+		t.join();
+	const auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - begin).count() / (ops * threads);
+}
+
+} // namespace
+
+int main() {
+	using pvec = rds::vector<int, rds::polymorphic_allocator<int>>;
+	using pobj = rds::polymorphic_allocator<obj64>;
+
+	// 요청마다 재사용하는 버퍼. release() 후에도 다시 이 버퍼부터 사용한다.
+	static std::byte scratch[64 * 1024];
+	rds::monotonic_buffer_resource mono(scratch, sizeof(scratch));
+	rds::unsynchronized_pool_resource pool;
+	rds::synchronized_pool_resource spool;
+	auto none = [] {};
+
+	std::printf("request-scoped vectors (16 x 64 ints per request), ns/vector\n");
+	std::printf("  rds::allocator                %8.2f\n", request_scoped<rds::vector<int>>([] { return rds::vector<int>(); }, none));
+	std::printf("  new_delete_resource           %8.2f\n", request_scoped<pvec>([] { return pvec(rds::new_delete_resource()); }, none));
+	std::printf("  monotonic_buffer_resource     %8.2f\n", request_scoped<pvec>([&] { return pvec(&mono); }, [&] { mono.release(); }));
+	std::printf("  unsynchronized_pool_resource  %8.2f\n", request_scoped<pvec>([&] { return pvec(&pool); }, none));
+	std::printf("  synchronized_pool_resource    %8.2f\n", request_scoped<pvec>([&] { return pvec(&spool); }, none));
+
+	constexpr std::size_t ops = 4'000'000;
+	std::printf("64-byte alloc/free churn, ns/op\n");
+	std::printf("  rds::allocator                %8.2f\n", churn(rds::allocator<obj64>(), ops));
+	std::printf("  new_delete_resource           %8.2f\n", churn(pobj(rds::new_delete_resource()), ops));
+	std::printf("  unsynchronized_pool_resource  %8.2f\n", churn(pobj(&pool), ops));
+	std::printf("  synchronized_pool_resource    %8.2f\n", churn(pobj(&spool), ops));
+
+	const unsigned threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+	std::printf("64-byte alloc/free churn, %u threads, ns/op\n", threads);
+	std::printf("  rds::allocator                %8.2f\n", churn_threads(rds::allocator<obj64>(), threads, ops / threads));
+	std::printf("  synchronized_pool_resource    %8.2f\n", churn_threads(pobj(&spool), threads, ops / threads));
+}
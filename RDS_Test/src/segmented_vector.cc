@@ -0,0 +1,69 @@
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <RDS/segmented_vector.h>
+
+/// @brief \ref copies_left 번 복사한 뒤에는 복사 생성자가 예외를 던지는 형식
+struct flaky {
+	static inline int copies_left = -1; // 음수이면 던지지 않는다.
+	static inline int alive = 0;
+	std::string s = "long enough to live on the heap";
+
+	flaky() {
+		++alive;
+	}
+	flaky(const flaky& o): s(o.s) {
+		if (copies_left == 0)
+			throw 0;
+		--copies_left;
+		++alive;
+	}
+	~flaky() {
+		--alive;
+	}
+};
+
+int main() {
+	rds::segmented_vector<int> v;
+	v.push_back(0);
+	const int* first = &v[0];
+	for (int i = 1; i < 100000; ++i)
+		v.push_back(i);
+	assert(&v[0] == first); // 추가해도 원소는 옮겨지지 않는다.
+	assert(v.size() == 100000 && v.back() == 99999);
+	assert(std::is_sorted(v.begin(), v.end()));
+	assert(*std::lower_bound(v.begin(), v.end(), 4242) == 4242);
+	assert(v.end() - v.begin() == 100000);
+
+	rds::segmented_vector<std::string, 4> s(10, "chunk");
+	s.emplace_back(s.front()); // 자기 원소를 인자로 넘겨도 안전하다.
+	assert(s.chunk_count() == 3 && s.back() == "chunk");
+	auto t = s;
+	s.clear();
+	s.shrink_to_fit();
+	assert(s.chunk_count() == 0 && t.size() == 11);
+	s = std::move(t);
+	assert(s.size() == 11);
+	s.swap(t);
+	assert(s.empty() && t.size() == 11);
+	s = t;
+	assert(s.size() == 11 && s[3] == "chunk");
+
+	const auto& cs = s;
+	rds::segmented_vector<std::string, 4>::const_iterator it = s.begin();
+	assert(it == cs.begin() && it[10] == "chunk");
+
+	// 복사 생성 중 예외가 발생해도 복사한 원소와 청크가 정리되어야 한다.
+	{
+		rds::segmented_vector<flaky, 4> src(10, flaky());
+		flaky::copies_left = 6;
+		try {
+			auto copy = src;
+			assert(false);
+		} catch (int) {
+		}
+		flaky::copies_left = -1;
+		assert(flaky::alive == 10);
+	}
+	assert(flaky::alive == 0);
+}
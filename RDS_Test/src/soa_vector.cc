@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <RDS/soa_vector.h>
+
+/// @brief \ref copies_left 번 복사한 뒤에는 복사 생성자가 예외를 던지는 형식
+struct flaky {
+	static inline int copies_left = -1; // 음수이면 던지지 않는다.
+	static inline int alive = 0;
+	std::string s = "long enough to live on the heap";
+
+	flaky() {
+		++alive;
+	}
+	flaky(const flaky& o): s(o.s) {
+		if (copies_left == 0)
+			throw 0;
+		--copies_left;
+		++alive;
+	}
+	~flaky() {
+		--alive;
+	}
+};
+
+using fields = rds::TypeList<int, std::string, double>;
+static_assert(std::is_same_v<rds::Get<fields, 1>, std::string>);
+static_assert(std::is_same_v<rds::soa_vector<fields>::column_type<2>, double>);
+
+int main() {
+	rds::soa_vector<fields> v;
+	for (int i = 0; i < 1000; ++i)
+		v.emplace_back(i, std::to_string(i), i * 0.5);
+	assert(v.size() == 1000 && v.capacity() >= 1000);
+
+	auto [id, name, weight] = v[42];
+	assert(id == 42 && name == "42" && weight == 21.0);
+	std::get<0>(v[42]) = -1; // 행 프록시는 원소를 참조한다.
+	assert(v.column<0>()[42] == -1);
+	v[42] = std::tuple{42, std::string("forty-two"), 21.0};
+	assert(v.column<1>()[42] == "forty-two");
+
+	// 한 열만 순회한다.
+	for (double& w: v.column<2>())
+		w *= 2;
+	assert(std::accumulate(v.column<2>().begin(), v.column<2>().end(), 0.0) == 999.0 * 1000 / 2);
+
+	v.emplace_back(0, std::get<1>(v.back()), 0.0); // 재할당이 일어나도 자기 원소를 인자로 넘길 수 있다.
+	assert(std::get<1>(v.back()) == "999");
+
+	auto copy = v;
+	v.pop_back();
+	v.resize(10);
+	assert(v.size() == 10 && std::get<1>(v.back()) == "9");
+	v.resize(12);
+	assert(std::get<0>(v.back()) == 0 && std::get<1>(v.back()).empty());
+	assert(copy.size() == 1001 && std::get<1>(copy[500]) == "500");
+
+	rds::soa_vector<fields> moved(std::move(copy));
+	assert(copy.empty() && moved.size() == 1001);
+	v = std::move(moved);
+	assert(v.size() == 1001);
+	v.swap(moved);
+	assert(v.empty() && moved.size() == 1001);
+	v = moved;
+	assert(v.size() == 1001 && v.data<0>()[7] == 7);
+
+	// 행 반복자로 한 열을 기준으로 정렬해도 행의 필드들은 함께 움직인다.
+	static_assert(std::is_same_v<std::iterator_traits<rds::soa_vector<fields>::iterator>::iterator_category, std::random_access_iterator_tag>);
+	{
+		rds::soa_vector<fields> rows;
+		for (int i = 0; i < 1000; ++i) {
+			const int k = (i * 7919) % 1000;
+			rows.emplace_back(k, std::to_string(k), k * 0.25);
+		}
+		std::sort(rows.begin(), rows.end(), [](const auto& l, const auto& r) { return std::get<1>(l) < std::get<1>(r); });
+		assert(std::is_sorted(rows.column<1>().begin(), rows.column<1>().end()));
+		for (auto [id, name, weight]: rows)
+			assert(name == std::to_string(id) && weight == id * 0.25);
+		const auto& crows = rows;
+		assert(crows.end() - crows.begin() == 1000 && std::get<1>(crows.begin()[2]) == "10");
+	}
+
+	// 같은 형식의 필드가 여럿이어도 열은 위치로 구분된다.
+	rds::soa_vector<rds::TypeList<float, float>> xy(4);
+	xy.column<1>()[3] = 1.5f;
+	assert(xy.column<0>()[3] == 0.0f && std::get<1>(xy[3]) == 1.5f);
+	const auto& cxy = xy;
+	static_assert(std::is_same_v<decltype(cxy.column<0>()), std::span<const float>>);
+	xy.clear();
+	assert(xy.empty());
+
+	// 복사 생성 중 예외가 발생해도 복사한 열과 메모리가 정리되어야 한다.
+	{
+		rds::soa_vector<rds::TypeList<int, flaky>> src(10);
+		flaky::copies_left = 6;
+		try {
+			auto copy = src;
+			assert(false);
+		} catch (int) {
+		}
+		flaky::copies_left = -1;
+		assert(flaky::alive == 10);
+	}
+	assert(flaky::alive == 0);
+}
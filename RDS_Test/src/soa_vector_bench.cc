@@ -0,0 +1,111 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <RDS/soa_vector.h>
+#include <RDS/vector.h>
+
+namespace {
+
+/// @brief 배열-구조체(AoS) 쪽의 한 행. 64 bytes
+struct particle {
+	float x, y, z;
+	float vx, vy, vz;
+	float mass;
+	std::uint32_t id;
+	double extra[4];
+};
+
+using particle_fields = rds::TypeList<float, float, float, float, float, float, float, std::uint32_t, double, double, double, double>;
+
+volatile double g_sink = 0;
+
+/// @brief \p f 를 \p rounds 번 실행한 가장 빠른 시간(ns/원소)
+template <class F>
+double best_of(std::size_t n, int rounds, F&& f) {
+	using clock = std::chrono::steady_clock;
+	double best = 0.0;
+	for (int r = 0; r < rounds; ++r) {
+		const auto begin = clock::now();
+		f();
+		const double ns = std::chrono::duration<double, std::nano>(clock::now() - begin).count() / n;
+		if (r == 0 || ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+} // namespace
+
+int main() {
+	constexpr std::size_t n = 4'000'000;
+	constexpr int rounds = 5;
+
+	rds::vector<particle> aos;
+	rds::soa_vector<particle_fields> soa;
+	aos.reserve(n);
+	soa.reserve(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		const float f = static_cast<float>(i % 1000);
+		aos.push_back(particle{f, f, f, 1, 1, 1, f, static_cast<std::uint32_t>(i), {0, 0, 0, 0}});
+		soa.emplace_back(f, f, f, 1.0f, 1.0f, 1.0f, f, static_cast<std::uint32_t>(i), 0.0, 0.0, 0.0, 0.0);
+	}
+
+	std::printf("%zu rows of %zu bytes\n", n, sizeof(particle));
+
+	// 필드 하나만 읽는다.
+	const double aos_sum = best_of(n, rounds, [&] {
+		float s = 0;
+		for (std::size_t i = 0; i < n; ++i)
+			s += aos[i].mass;
+		g_sink = s;
+	});
+	const double soa_sum = best_of(n, rounds, [&] {
+		float s = 0;
+		for (float m: soa.column<6>())
+			s += m;
+		g_sink = s;
+	});
+	std::printf("sum(mass)         AoS %6.3f ns/row | SoA %6.3f ns/row\n", aos_sum, soa_sum);
+
+	// 필드 여섯 개를 읽고 세 개를 쓴다.
+	const double aos_step = best_of(n, rounds, [&] {
+		for (std::size_t i = 0; i < n; ++i) {
+			aos[i].x += aos[i].vx;
+			aos[i].y += aos[i].vy;
+			aos[i].z += aos[i].vz;
+		}
+	});
+	const double soa_step = best_of(n, rounds, [&] {
+		float* x = soa.data<0>();
+		float* y = soa.data<1>();
+		float* z = soa.data<2>();
+		const float* vx = soa.data<3>();
+		const float* vy = soa.data<4>();
+		const float* vz = soa.data<5>();
+		for (std::size_t i = 0; i < n; ++i) {
+			x[i] += vx[i];
+			y[i] += vy[i];
+			z[i] += vz[i];
+		}
+	});
+	std::printf("position += vel   AoS %6.3f ns/row | SoA %6.3f ns/row\n", aos_step, soa_step);
+
+	// 행 프록시로 필드 여섯 개를 읽는다.
+	const double aos_row = best_of(n, rounds, [&] {
+		double s = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			const particle& p = aos[i];
+			s += p.x + p.vx + p.mass + p.id + p.extra[0] + p.extra[3];
+		}
+		g_sink = s;
+	});
+	const double soa_row = best_of(n, rounds, [&] {
+		double s = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			const auto& [x, y, z, vx, vy, vz, mass, id, e0, e1, e2, e3] = soa[i];
+			s += x + vx + mass + id + e0 + e3;
+		}
+		g_sink = s;
+	});
+	std::printf("whole row         AoS %6.3f ns/row | SoA %6.3f ns/row\n", aos_row, soa_row);
+}
@@ -0,0 +1,68 @@
+#include <cassert>
+#include <string>
+#include <RDS/static_vector.h>
+
+constexpr int sum_first(int n) {
+	rds::static_vector<int, 8> v;
+	for (int i = 1; i <= n; ++i)
+		v.push_back(i);
+	int s = 0;
+	for (auto e: v)
+		s += e;
+	return s;
+}
+static_assert(sum_first(4) == 10);
+
+/// @brief \ref copies_left 번 복사한 뒤에는 복사 생성자가 예외를 던지는 형식
+struct flaky {
+	static inline int copies_left = -1; // 음수이면 던지지 않는다.
+	static inline int alive = 0;
+	std::string s = "long enough to live on the heap";
+
+	flaky() {
+		++alive;
+	}
+	flaky(const flaky& o): s(o.s) {
+		if (copies_left == 0)
+			throw 0;
+		--copies_left;
+		++alive;
+	}
+	~flaky() {
+		--alive;
+	}
+};
+
+/// @brief \p f 가 예외를 던지고, 그 안에서 생성된 원소가 모두 소멸되었는지 확인한다.
+template <class F>
+void expect_no_leak(int copies, F&& f) {
+	const int alive = flaky::alive;
+	flaky::copies_left = copies;
+	bool thrown = false;
+	try {
+		f();
+	} catch (int) {
+		thrown = true;
+	}
+	flaky::copies_left = -1;
+	assert(thrown && flaky::alive == alive);
+}
+
+int main() {
+	rds::static_vector<std::string, 4> v(2, "rds");
+	v.emplace_back("static");
+	v.try_push_back("vector");
+	v.try_push_back("full"); // nullptr
+
+	// 생성자에서 원소 생성이 실패해도 이미 생성한 원소는 소멸되어야 한다.
+	{
+		using fvector = rds::static_vector<flaky, 8>;
+		const flaky proto;
+		expect_no_leak(3, [&] { fvector(6, proto); });
+		expect_no_leak(1, [&] { fvector{proto, proto, proto}; });
+		fvector src(6, proto);
+		expect_no_leak(3, [&] { fvector copy(src); });
+		expect_no_leak(3, [&] { fvector moved(std::move(src)); }); // 이동 생성자가 없으므로 복사한다.
+	}
+	assert(flaky::alive == 0);
+}
@@ -0,0 +1,38 @@
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+#include <RDS/thread_cache.h>
+#include <RDS/vector.h>
+
+using cached_vector = rds::vector<std::string, rds::thread_cache_allocator<std::string>>;
+
+// 정적 컨테이너는 주 스레드의 캐시가 소멸한 뒤에 소멸하므로, 그때의 해제는 중앙 리스트로 가야 한다.
+static cached_vector survivor;
+
+int main() {
+	for (int i = 0; i < 100; ++i)
+		survivor.push_back(std::to_string(i) + std::string(40, '.'));
+
+	std::vector<std::thread> workers;
+	for (int t = 0; t < 4; ++t) {
+		workers.emplace_back([] {
+			// 캐시보다 먼저 생성되었으므로 캐시보다 나중에 소멸한다.
+			thread_local cached_vector late;
+			for (int i = 0; i < 1000; ++i)
+				late.push_back(std::string(i % 200, 'x'));
+			cached_vector v;
+			for (int i = 0; i < 1000; ++i)
+				v.push_back(std::string(i % 200, 'y'));
+			assert(v.size() == 1000 && late.size() == 1000);
+		});
+	}
+	for (auto& w: workers)
+		w.join();
+
+	// 다른 스레드가 중앙 리스트로 돌려준 메모리를 다시 받아 쓴다.
+	cached_vector v;
+	for (int i = 0; i < 1000; ++i)
+		v.push_back(std::string(i % 200, 'z'));
+	assert(survivor.size() == 100 && v.size() == 1000);
+}
@@ -0,0 +1,48 @@
+#include <cassert>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <RDS/tracking_allocator.h>
+#include <RDS/vector.h>
+
+int main() {
+	static const auto ingest = rds::alloc_tracker::tag("ingest");
+	static const auto scratch = rds::alloc_tracker::tag("scratch");
+	{
+		rds::vector<int, rds::tracking_allocator<int>> v{rds::tracking_allocator<int>(ingest)};
+		for (int i = 0; i < 1000; ++i)
+			v.push_back(i);
+
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 4; ++t) {
+			threads.emplace_back([] {
+				rds::vector<double, rds::tracking_allocator<double>> w{rds::tracking_allocator<double>(scratch)};
+				w.reserve(100000);
+			});
+		}
+		for (auto& t: threads)
+			t.join();
+
+		const auto s = rds::alloc_tracker::snapshot();
+		assert(s.bytes_in_use == static_cast<std::int64_t>(v.capacity() * sizeof(int)));
+		assert(s.peak_bytes >= 800000);
+		assert(s.tags[ingest].name == "ingest" && s.tags[ingest].bytes_in_use > 0);
+		assert(s.tags[scratch].allocations == 4 && s.tags[scratch].bytes_in_use == 0);
+	}
+
+	// 스레드 카운터보다 나중에 소멸하는 스레드 지역 컨테이너의 해제도 집계되어야 한다.
+	static const auto late = rds::alloc_tracker::tag("late");
+	std::thread([] {
+		thread_local rds::vector<int, rds::tracking_allocator<int>> w{rds::tracking_allocator<int>(late)};
+		w.reserve(1000);
+	}).join();
+	assert(rds::alloc_tracker::snapshot().tags[late].bytes_in_use == 0);
+
+	const auto s = rds::alloc_tracker::snapshot();
+	assert(s.bytes_in_use == 0 && s.allocations == s.deallocations);
+	std::printf("allocations %llu, peak %lld bytes\n", static_cast<unsigned long long>(s.allocations), static_cast<long long>(s.peak_bytes));
+	for (std::size_t i = 0; i < s.size_histogram.size(); ++i) {
+		if (s.size_histogram[i])
+			std::printf("  [%zu, %zu) bytes: %llu\n", std::size_t{1} << i, std::size_t{1} << (i + 1), static_cast<unsigned long long>(s.size_histogram[i]));
+	}
+}
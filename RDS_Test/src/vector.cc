@@ -1,8 +1,209 @@
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 #include <RDS/vector.h>
 
+namespace {
+
+/// @brief 아직 해제하지 않은 할당 수를 세고, id 가 다르면 서로 다르다고 비교되는 할당자
+/// @tparam Propagate 복사/이동 대입과 교환에서 할당자를 넘겨주는지 여부
+template <class T, bool Propagate>
+struct tagged_allocator {
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+	using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+	using propagate_on_container_swap = std::bool_constant<Propagate>;
+	template <class U>
+	struct rebind {
+		using other = tagged_allocator<U, Propagate>;
+	};
+
+	static inline int live = 0;
+	int id = 0;
+
+	tagged_allocator() = default;
+	explicit tagged_allocator(int i): id(i) {}
+	template <class U>
+	tagged_allocator(const tagged_allocator<U, Propagate>& o): id(o.id) {}
+
+	T* allocate(std::size_t n) {
+		++live;
+		return std::allocator<T>().allocate(n);
+	}
+	void deallocate(T* p, std::size_t n) {
+		--live;
+		std::allocator<T>().deallocate(p, n);
+	}
+	template <class U>
+	bool operator==(const tagged_allocator<U, Propagate>& o) const {
+		return id == o.id;
+	}
+};
+
+/// @brief \ref copies_left 번 복사한 뒤에는 복사 생성자가 예외를 던지는 형식
+struct flaky {
+	static inline int copies_left = -1; // 음수이면 던지지 않는다.
+	static inline int alive = 0;
+	std::string s = "long enough to live on the heap";
+
+	flaky() {
+		++alive;
+	}
+	flaky(const flaky& o): s(o.s) {
+		if (copies_left == 0)
+			throw 0;
+		--copies_left;
+		++alive;
+	}
+	flaky(flaky&& o): flaky(static_cast<const flaky&>(o)) {}
+	flaky& operator=(const flaky&) = default;
+	~flaky() {
+		--alive;
+	}
+};
+
+/// @brief \p f 가 예외를 던지는지 확인하고, \p f 안에서 생성된 원소와 할당이 모두 정리되었는지 확인한다.
+template <class F>
+void expect_no_leak(int copies, F&& f) {
+	using alloc = tagged_allocator<flaky, false>;
+	const int alive = flaky::alive;
+	const int live = alloc::live;
+	flaky::copies_left = copies;
+	bool thrown = false;
+	try {
+		f();
+	} catch (int) {
+		thrown = true;
+	}
+	flaky::copies_left = -1;
+	assert(thrown && flaky::alive == alive && alloc::live == live);
+}
+
+/// @brief 복사/이동 횟수를 세는 형식. \p NothrowMove 이면 이동 생성자가 noexcept 이다.
+/// @tparam Tag 횟수를 따로 세기 위해 형식을 구분한다.
+template <bool NothrowMove, int Tag=0>
+struct counted {
+	static inline int copies = 0;
+	static inline int moves = 0;
+	int v;
+
+	counted(int x): v(x) {}
+	counted(const counted& o): v(o.v) {
+		++copies;
+	}
+	counted(counted&& o) noexcept(NothrowMove): v(o.v) {
+		++moves;
+	}
+};
+
+/// @brief 복사/이동 생성자가 있지만 memcpy 로 옮겨도 되는 형식
+using relocatable = counted<true, 1>;
+
+/// @brief \p n 개를 채운 뒤 용량을 늘려서 재배치하고, 값이 보존되었는지 확인한다.
+template <class T>
+void grow(std::size_t n) {
+	rds::vector<T> v;
+	v.reserve(n);
+	for (std::size_t i = 0; i < n; ++i)
+		v.emplace_back(static_cast<int>(i));
+	T::copies = 0;
+	T::moves = 0;
+	v.reserve(2 * n);
+	for (std::size_t i = 0; i < n; ++i)
+		assert(v[i].v == static_cast<int>(i));
+}
+
+} // namespace
+
+template <>
+struct rds::is_trivially_relocatable<relocatable>: std::true_type {};
+
+static_assert(std::contiguous_iterator<rds::vector<int>::iterator>);
+
 int main() {
 
 	rds::vector<int> v(2, 3);
 	v.reserve(10);
-}
\ No newline at end of file
+	{
+		auto const b = v.begin();
+		assert(b[1] == 3 && *(1 + b) == 3 && 2 + b == v.end() && v.end() - b == 2);
+		assert(b < b + 1 && b + 1 <= v.end() && !(v.end() < b + 2) && v.end() == b + 2);
+	}
+
+	rds::vector<int, rds::allocator<int>, rds::growth_x1_5> w;
+	for (int i = 0; i < 100; ++i)
+		w.push_back(i);
+	w.emplace_back(w.front());
+	w.pop_back();
+
+	rds::small_vector<int, 4> s;
+	for (int i = 0; i < 8; ++i)
+		s.push_back(i);
+	auto t = s;
+
+	// 생성자에서 원소 생성이 실패해도 이미 생성한 원소와 버퍼가 정리되어야 한다.
+	using fvector = rds::vector<flaky, tagged_allocator<flaky, false>>;
+	using fsmall = rds::small_vector<flaky, 2, tagged_allocator<flaky, false>>;
+	{
+		const flaky proto;
+		expect_no_leak(5, [&] { fvector(10, proto); });
+		expect_no_leak(5, [&] { fsmall(10, proto); });
+		fvector src(10, proto);
+		fsmall ssrc(10, proto);
+		expect_no_leak(5, [&] { fvector copy(src); });
+		expect_no_leak(5, [&] { fsmall copy(ssrc); });
+
+		// 할당자가 달라서 원소 단위로 옮기다 실패해도, 옮긴 원소는 소멸되어야 한다.
+		expect_no_leak(5, [&] {
+			fvector dst{tagged_allocator<flaky, false>(1)};
+			dst = std::move(src);
+		});
+	}
+	assert(flaky::alive == 0 && fvector::allocator_type::live == 0);
+
+	// 재배치: trivially relocatable 하면 memcpy 로, 아니면 move_if_noexcept 로 옮긴다.
+	static_assert(rds::is_trivially_relocatable_v<int> && !rds::is_trivially_relocatable_v<std::string>);
+	grow<relocatable>(100);
+	assert(relocatable::copies == 0 && relocatable::moves == 0);
+	grow<counted<true>>(100);
+	assert(counted<true>::copies == 0 && counted<true>::moves == 100);
+	grow<counted<false>>(100); // 이동이 예외를 던질 수 있으면 강한 보장을 위해 복사한다.
+	assert(counted<false>::copies == 100 && counted<false>::moves == 0);
+
+	// 할당자 전파: propagate 속성이 true 이면 대입과 교환에서 할당자를 넘겨준다.
+	using pvec = rds::vector<int, tagged_allocator<int, true>>;
+	using svec = rds::vector<int, tagged_allocator<int, false>>;
+	{
+		pvec a(10, 1, tagged_allocator<int, true>(1));
+		pvec b(3, 2, tagged_allocator<int, true>(2));
+		b = a; // POCCA
+		assert(b.get_allocator().id == 1 && b.size() == 10 && b[9] == 1);
+		pvec c(tagged_allocator<int, true>(3));
+		const int* buf = a.data();
+		c = std::move(a); // POCMA: 메모리를 그대로 넘겨받는다.
+		assert(c.get_allocator().id == 1 && c.data() == buf && a.empty());
+		b.swap(c);
+		assert(b.get_allocator().id == 1 && b.data() == buf);
+		pvec d(b);
+		assert(d.get_allocator().id == 1 && d.data() != b.data());
+	}
+	{
+		svec a(10, 1, tagged_allocator<int, false>(1));
+		svec b(3, 2, tagged_allocator<int, false>(2));
+		b = a; // 전파하지 않으면 자기 할당자로 복사한다.
+		assert(b.get_allocator().id == 2 && b.size() == 10 && b[9] == 1);
+		svec c(tagged_allocator<int, false>(3));
+		const int* buf = a.data();
+		c = std::move(a); // 할당자가 다르면 메모리를 넘겨받을 수 없어 원소 단위로 옮긴다.
+		assert(c.get_allocator().id == 3 && c.data() != buf && c.size() == 10 && a.empty());
+		svec d(tagged_allocator<int, false>(3));
+		buf = c.data();
+		d = std::move(c); // 할당자가 같으면 넘겨받는다.
+		assert(d.data() == buf && d.size() == 10 && c.empty());
+	}
+	assert(pvec::allocator_type::live == 0 && svec::allocator_type::live == 0);
+}
@@ -0,0 +1,161 @@
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#include <vector>
+#include <RDS/segmented_vector.h>
+#include <RDS/vector.h>
+
+namespace {
+
+struct large {
+	large() = default;
+	large(std::size_t v) {
+		for (auto& e: payload)
+			e = v;
+	}
+	std::size_t payload[32]{}; // 256 bytes
+};
+
+/// @brief \p Vec 에 \p n 개의 원소를 추가하는 데 걸린 시간(ns/op)을 반환
+template <class Vec>
+double bench_append(std::size_t n, int rounds) {
+	using clock = std::chrono::steady_clock;
+	double best = 0.0;
+	for (int r = 0; r < rounds; ++r) {
+		const auto begin = clock::now();
+		Vec v;
+		for (std::size_t i = 0; i < n; ++i)
+			v.emplace_back(i);
+		const auto end = clock::now();
+		const double ns = std::chrono::duration<double, std::nano>(end - begin).count() / n;
+		if (r == 0 || ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+/// @brief 할당 횟수를 세는 할당자
+std::size_t g_allocs = 0;
+volatile std::size_t g_sink = 0;
+
+template <class T>
+struct counting_allocator: rds::allocator<T> {
+	using value_type = T;
+	counting_allocator() = default;
+	template <class U>
+	counting_allocator(const counting_allocator<U>&) {}
+	T* allocate(std::size_t n) {
+		++g_allocs;
+		return rds::allocator<T>::allocate(n);
+	}
+};
+
+/// @brief 원소 \p k 개짜리 임시 벡터를 만들고 버리는 요청 하나의 지연 시간(ns)과 할당 횟수를 측정
+template <class Vec>
+void bench_request(const char* name, std::size_t k) {
+	using clock = std::chrono::steady_clock;
+	constexpr std::size_t requests = 1'000'000;
+	std::size_t sink = 0;
+	g_allocs = 0;
+	const auto begin = clock::now();
+	for (std::size_t r = 0; r < requests; ++r) {
+		Vec v;
+		for (std::size_t i = 0; i < k; ++i)
+			v.push_back(i + r);
+		sink += v[k - 1];
+	}
+	const auto end = clock::now();
+	g_sink = sink;
+	std::printf("  %-22s k=%-3zu %7.2f ns/req %6.2f allocs/req\n", name, k,
+		std::chrono::duration<double, std::nano>(end - begin).count() / requests,
+		static_cast<double>(g_allocs) / requests);
+}
+
+template <std::size_t N>
+void report_small(std::size_t k) {
+	using alloc = counting_allocator<std::size_t>;
+	char name[32];
+	std::snprintf(name, sizeof(name), "rds::small_vector<%zu>", N);
+	bench_request<rds::vector<std::size_t, alloc>>("rds::vector", k);
+	bench_request<rds::small_vector<std::size_t, N, alloc>>(name, k);
+}
+
+template <class T>
+void report(const char* name, std::size_t n) {
+	constexpr int rounds = 5;
+	std::printf("%-8s n=%-9zu std::vector %7.2f ns/op | rds::vector<x2> %7.2f ns/op | rds::vector<x1.5> %7.2f ns/op\n",
+		name, n,
+		bench_append<std::vector<T>>(n, rounds),
+		bench_append<rds::vector<T, rds::allocator<T>, rds::growth_x2>>(n, rounds),
+		bench_append<rds::vector<T, rds::allocator<T>, rds::growth_x1_5>>(n, rounds));
+}
+
+/// @brief `Vec(n, val)` 로 \p n 개의 원소를 채우는 처리량(GB/s)을 반환
+template <class Vec, class T>
+double bench_fill(std::size_t n, const T& val, int rounds) {
+	using clock = std::chrono::steady_clock;
+	double best = 0.0;
+	for (int r = 0; r < rounds; ++r) {
+		const auto begin = clock::now();
+		Vec v(n, val);
+		const auto end = clock::now();
+		g_sink = sizeof(v[n - 1]);
+		const double gbs = n * sizeof(T) / std::chrono::duration<double>(end - begin).count() / 1e9;
+		if (gbs > best)
+			best = gbs;
+	}
+	return best;
+}
+
+template <class T>
+void report_fill(const char* name, std::size_t n, const T& val) {
+	constexpr int rounds = 5;
+	std::printf("%-8s n=%-9zu std::vector(n, v) %6.2f GB/s | rds::vector(n, v) %6.2f GB/s\n",
+		name, n,
+		bench_fill<std::vector<T>>(n, val, rounds),
+		bench_fill<rds::vector<T>>(n, val, rounds));
+}
+
+/// @brief \p n 개를 하나씩 추가하면서 한 번의 추가에 걸린 최대 시간과 평균 시간을 잰다.
+template <class Vec>
+void bench_append_latency(const char* name, std::size_t n) {
+	using clock = std::chrono::steady_clock;
+	Vec v;
+	double worst = 0.0;
+	const auto begin = clock::now();
+	for (std::size_t i = 0; i < n; ++i) {
+		const auto t0 = clock::now();
+		v.push_back(i);
+		const double ns = std::chrono::duration<double, std::nano>(clock::now() - t0).count();
+		if (ns > worst)
+			worst = ns;
+	}
+	const double avg = std::chrono::duration<double, std::nano>(clock::now() - begin).count() / n;
+	g_sink = v[n - 1];
+	std::printf("  %-24s n=%-9zu avg %6.2f ns/op (incl. timer) | worst %12.0f ns\n", name, n, avg, worst);
+}
+
+} // namespace
+
+int main() {
+	report<int>("int", 1'000);
+	report<int>("int", 1'000'000);
+	report<large>("large", 1'000);
+	report<large>("large", 100'000);
+
+	std::printf("bulk fill (size constructor):\n");
+	report_fill<int>("int", 16'000'000, 0);
+	report_fill<int>("int", 16'000'000, 0x01020304);
+	report_fill<large>("large", 250'000, large(7));
+
+	std::printf("append latency:\n");
+	bench_append_latency<rds::vector<std::size_t>>("rds::vector", 16'000'000);
+	bench_append_latency<rds::segmented_vector<std::size_t>>("rds::segmented_vector", 16'000'000);
+
+	std::printf("per-request vectors (push k elements, destroy):\n");
+	for (std::size_t k: {3, 8, 20}) {
+		report_small<4>(k);
+		report_small<8>(k);
+		report_small<16>(k);
+	}
+}
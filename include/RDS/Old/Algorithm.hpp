@@ -2,8 +2,13 @@
 #define RDS_ALGORITHM_HPP
 
 #include "Functional.hpp"
+#include "Simd.hpp"
+#include "Tag.h"
 
+#include <cstddef>
 #include <initializer_list>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace rds
@@ -71,6 +76,59 @@ template <class __Iterator_t>
 using Derive_Value_t_From_Iterator_t =
     std::remove_reference_t<decltype(*std::declval<__Iterator_t>())>;
 
+namespace impl
+{
+
+/** @brief 반복자가 연속된 메모리를 가리키는지 여부
+ *  @details 포인터, 태그가 \ref tag::ContiguosIterator_Tag 를 상속하는 반복자, 그리고
+ *  `iterator_concept` 가 `std::contiguous_iterator_tag` 인 반복자(\ref vector, \ref array 의 반복자)가 해당된다.
+ */
+template <class __Iterator_t, class = void>
+struct IsContiguous: std::false_type
+{};
+
+template <class __T_t>
+struct IsContiguous<__T_t*>: std::true_type
+{};
+
+template <class __Iterator_t>
+struct IsContiguous<__Iterator_t, std::void_t<typename __Iterator_t::IteratorTag_t>>
+    : std::is_base_of<tag::ContiguosIterator_Tag, typename __Iterator_t::IteratorTag_t>
+{};
+
+template <class __Iterator_t>
+struct IsContiguous<__Iterator_t, std::void_t<typename __Iterator_t::iterator_concept>>
+    : std::is_same<std::contiguous_iterator_tag, typename __Iterator_t::iterator_concept>
+{};
+
+template <class __Iterator_t>
+using Element_t = std::remove_cv_t<Derive_Value_t_From_Iterator_t<__Iterator_t>>;
+
+/** @brief SIMD 커널로 \ref Find, \ref Count 를 처리할 수 있는지 여부
+ *  @details 찾는 값의 자료형이 원소와 같아야 한다. (다르면 `operator==` 의 변환 규칙이 달라질 수 있다)
+ */
+template <class __Iterator_t, class __T_t>
+inline constexpr bool IsSimdFindable_v =
+    IsContiguous<__Iterator_t>::value && std::is_same_v<Element_t<__Iterator_t>, std::remove_cv_t<__T_t>> &&
+    simd::IsEqualityVectorizable_v<Element_t<__Iterator_t>>;
+
+/** @brief SIMD 커널로 \ref MinElement, \ref MaxElement 를 처리할 수 있는지 여부 */
+template <class __Iterator_t>
+inline constexpr bool IsSimdOrderable_v =
+    IsContiguous<__Iterator_t>::value && simd::IsOrderVectorizable_v<Element_t<__Iterator_t>>;
+
+/** @brief 비어있지 않은 연속 범위의 첫 원소의 주소 */
+template <class __Iterator_t>
+auto FirstAddress(__Iterator_t it) -> const Element_t<__Iterator_t>*
+{
+    if constexpr (std::is_pointer_v<__Iterator_t>)
+        return it;
+    else
+        return &*it;
+}
+
+} // namespace impl
+
 template <class __ForwardIterator_t, class __Compare_t>
 auto CompareElement(__ForwardIterator_t it_first, __ForwardIterator_t it_last,
                     __Compare_t compare) -> __ForwardIterator_t
@@ -89,6 +147,31 @@ auto CompareElement(__ForwardIterator_t it_first, __ForwardIterator_t it_last,
     return it_target;
 }
 
+namespace impl
+{
+
+/** @brief 연속 범위에서 SIMD 커널로 가장 작은(큰) 첫 원소를 찾는다.
+ *  @details 범위에 NaN이 있으면 결과가 비교자 버전과 같도록 \ref CompareElement 로 다시 찾는다.
+ */
+template <bool __IsMax_v, class __Iterator_t, class __Compare_t>
+auto MinMaxElementContiguous(__Iterator_t it_first, __Iterator_t it_last,
+                             __Compare_t compare) -> __Iterator_t
+{
+    if (it_first == it_last)
+        return it_last;
+
+    const auto        count = it_last - it_first;
+    const std::size_t index = simd::MinMaxIndex<__IsMax_v>(
+        FirstAddress(it_first), static_cast<std::size_t>(count));
+
+    if (index == simd::NanFound_v)
+        return CompareElement(it_first, it_last, compare);
+
+    return it_first + static_cast<decltype(count)>(index);
+}
+
+} // namespace impl
+
 /** @brief 주어진 범위에서 가장 작은 원소를 가리키는 반복자를 반환한다.
  *   @note 이 버전의 `MinElement`는 주어진 범위의 원소를 비교할 때, 원소의
  *   `operator<`를 사용한다.
@@ -98,7 +181,10 @@ inline auto MinElement(__ForwardIterator_t it_first,
                        __ForwardIterator_t it_last) -> __ForwardIterator_t
 {
     using Value_t = Derive_Value_t_From_Iterator_t<__ForwardIterator_t>;
-    return CompareElement(it_first, it_last, Less<Value_t>());
+    if constexpr (impl::IsSimdOrderable_v<__ForwardIterator_t>)
+        return impl::MinMaxElementContiguous<false>(it_first, it_last, Less<Value_t>());
+    else
+        return CompareElement(it_first, it_last, Less<Value_t>());
 }
 
 /** @overload MinElement
@@ -122,7 +208,10 @@ inline auto MaxElement(__ForwardIterator_t it_first,
                        __ForwardIterator_t it_last) -> __ForwardIterator_t
 {
     using Value_t = Derive_Value_t_From_Iterator_t<__ForwardIterator_t>;
-    return CompareElement(it_first, it_last, Greater<Value_t>());
+    if constexpr (impl::IsSimdOrderable_v<__ForwardIterator_t>)
+        return impl::MinMaxElementContiguous<true>(it_first, it_last, Greater<Value_t>());
+    else
+        return CompareElement(it_first, it_last, Greater<Value_t>());
 }
 
 /** @overload MaxElement
@@ -139,6 +228,62 @@ inline auto MaxElement(__ForwardIterator_t it_first,
 
 #pragma endregion MinMaxElement
 
+#pragma region FindCount
+
+/** @brief 주어진 범위에서 값이 `val` 과 같은 첫 원소를 가리키는 반복자를 반환한다.
+ *   찾지 못하면 `it_last` 를 반환한다.
+ *   @note 연속 범위의 32/64비트 정수와 실수는 SIMD 커널로 한 번에 여러 원소를 비교한다.
+ */
+template <class __InputIterator_t, class __T_t>
+auto Find(__InputIterator_t it_first, __InputIterator_t it_last,
+          const __T_t& val) -> __InputIterator_t
+{
+    if constexpr (impl::IsSimdFindable_v<__InputIterator_t, __T_t>)
+    {
+        if (it_first == it_last)
+            return it_last;
+
+        const auto        count = it_last - it_first;
+        const std::size_t index = simd::Find(impl::FirstAddress(it_first),
+                                             static_cast<std::size_t>(count), val);
+        return it_first + static_cast<decltype(count)>(index);
+    }
+    else
+    {
+        for (; it_first != it_last; ++it_first)
+            if (*it_first == val)
+                break;
+        return it_first;
+    }
+}
+
+/** @brief 주어진 범위에서 값이 `val` 과 같은 원소의 수를 반환한다.
+ *   @note 연속 범위의 32/64비트 정수와 실수는 SIMD 커널로 한 번에 여러 원소를 비교한다.
+ */
+template <class __InputIterator_t, class __T_t>
+auto Count(__InputIterator_t it_first, __InputIterator_t it_last,
+           const __T_t& val) -> std::size_t
+{
+    if constexpr (impl::IsSimdFindable_v<__InputIterator_t, __T_t>)
+    {
+        if (it_first == it_last)
+            return 0;
+
+        return simd::Count(impl::FirstAddress(it_first),
+                           static_cast<std::size_t>(it_last - it_first), val);
+    }
+    else
+    {
+        std::size_t count = 0;
+        for (; it_first != it_last; ++it_first)
+            if (*it_first == val)
+                ++count;
+        return count;
+    }
+}
+
+#pragma endregion FindCount
+
 #pragma region Fill
 
 /** @brief 반복자로 주어진 범위의 모든 원소를 주어진 값으로 채운다.
@@ -3,16 +3,27 @@
 #ifndef RDS_ALLOCATOR_TRAIT_HPP
 #define RDS_ALLOCATOR_TRAIT_HPP
 
+#include <cstring>
+#include <type_traits>
 #include <utility> // std::forward
 
+#include "../allocator.h"
+
 #include "Mallocator.hpp"
 #include "Nallocator.hpp"
+#include "Pallocator.hpp"
+#include "Sallocator.hpp"
+#include "Tallocator.hpp"
 
 namespace rds
 {
 
 /** @brief Allocator 에 대한 제너릭 인터페이스 클래스
  *  @tparam __Alloc_t 사용할 Allocator 클래스
+ *  @details
+ *  컨테이너는 할당자 인스턴스를 보관하고(\ref AllocatorStorage), 그 인스턴스를
+ *  첫 번째 인자로 넘겨 호출한다. 따라서 풀이나 아레나처럼 상태를 가지는
+ *  할당자도 컨테이너마다 따로 사용할 수 있다.
  */
 template <class __Alloc_t>
 class AllocatorTraits
@@ -27,20 +38,62 @@ public:
 
 public:
     /** @brief 지정된 크기만큼 메모리를 할당한다.
+     *  @param alloc 메모리를 할당할 할당자 인스턴스
      *  @param count 할당할 메모리의 크기
      *  @return 할당된 메모리의 시작 주소
      */
-    static auto Allocate(Size_t count) -> Value_t*
+    static auto Allocate(Allocator_t& alloc, Size_t count) -> Value_t*
     {
-        return Allocator_t().Allocate(count);
+        return alloc.Allocate(count);
     }
 
     /** @brief 할당된 메모리를 해제한다.
+     *  @param alloc 메모리를 할당했던 할당자 인스턴스
      *  @param ptr 할당된 메모리의 시작 주소
+     *  @param count 할당할 때 요청했던 크기
+     *  @details 컨테이너는 항상 이 함수를 사용한다. 크기를 알려주므로 크기
+     *  등급이나 풀을 사용하는 할당자가 헤더 없이 바로 해제할 수 있다.
+     */
+    static auto Deallocate(Allocator_t& alloc, const Value_t* ptr,
+                           Size_t count) -> void
+    {
+        alloc.Deallocate(ptr, count);
+    }
+
+    /** @overload
+     *  @note 크기 없이 해제할 수 있는 할당자(\ref Nallocator,
+     *  \ref Mallocator, \ref Pallocator)에만 사용한다.
+     */
+    static auto Deallocate(Allocator_t& alloc, const Value_t* ptr) -> void
+    {
+        alloc.Deallocate(ptr);
+    }
+
+    /** @overload
+     *  @note 기본 생성한 할당자를 사용하므로, 상태가 없는 할당자에만 사용한다.
+     */
+    static auto Allocate(Size_t count) -> Value_t*
+    {
+        Allocator_t alloc;
+        return Allocate(alloc, count);
+    }
+
+    /** @overload
+     *  @note 기본 생성한 할당자를 사용하므로, 상태가 없는 할당자에만 사용한다.
      */
     static auto Deallocate(const Value_t* ptr) -> void
     {
-        Allocator_t().Deallocate(ptr);
+        Allocator_t alloc;
+        Deallocate(alloc, ptr);
+    }
+
+    /** @overload
+     *  @note 기본 생성한 할당자를 사용하므로, 상태가 없는 할당자에만 사용한다.
+     */
+    static auto Deallocate(const Value_t* ptr, Size_t count) -> void
+    {
+        Allocator_t alloc;
+        Deallocate(alloc, ptr, count);
     }
 
     /// @} // Memory Allocation & Deallocation
@@ -48,28 +101,229 @@ public:
     /// @{ @name Object Construction & Deconstruction
 public:
     /** @brief 전달된 포인터의 위치에 객체들을 생성한다.
+     *  @param alloc 객체를 생성할 할당자 인스턴스
      *  @param ptr 객체를 생성할 위치를 가리키는 포인터
      *  @param count 생성할 객체의 개수
      *  @param ctor_args 객체를 생성할 때 생성자에 전달할 인자(들)
      */
     template <class... CtorArgs_t>
-    static auto Construct(Value_t* ptr, Size_t count, CtorArgs_t&&... ctor_args)
-        -> void
+    static auto Construct(Allocator_t& alloc, Value_t* ptr, Size_t count,
+                          CtorArgs_t&&... ctor_args) -> void
     {
-        Allocator_t().Construct(ptr, count,
-                                std::forward<CtorArgs_t>(ctor_args)...);
+        if constexpr (sizeof...(CtorArgs_t) == 0 &&
+                      is_zero_initializable_v<Value_t>)
+        {
+            if (count != 0)
+                std::memset(static_cast<void*>(ptr), 0,
+                            sizeof(Value_t) * count);
+        }
+        else if constexpr (sizeof...(CtorArgs_t) == 1 &&
+                           (std::is_same_v<std::remove_cvref_t<CtorArgs_t>,
+                                           Value_t> &&
+                            ...) &&
+                           (std::is_lvalue_reference_v<CtorArgs_t> && ...))
+        {
+            // 같은 값을 여러 개 복사할 때만 채우기로 처리한다. 하나만 만들 때는 아래처럼 그대로 전달한다.
+            if (count != 1)
+                ConstructFill(alloc, ptr, count, ctor_args...);
+            else
+                alloc.Construct(ptr, count, ctor_args...);
+        }
+        else
+        {
+            alloc.Construct(ptr, count,
+                            std::forward<CtorArgs_t>(ctor_args)...);
+        }
     }
 
     /** @brief 전달된 포인터의 위치에 있는 객체들을 소멸시킨다.
+     *  @param alloc 객체를 소멸시킬 할당자 인스턴스
      *  @param ptr 객체를 소멸시킬 위치를 가리키는 포인터
      *  @param count 소멸시킬 객체의 개수
+     *  @note 소멸자가 trivial 한 자료형이면 아무 것도 하지 않는다.
+     */
+    static auto Deconstruct(Allocator_t& alloc, const Value_t* ptr,
+                            Size_t count) -> void
+    {
+        if constexpr (!std::is_trivially_destructible_v<Value_t>)
+            alloc.Deconstruct(ptr, count);
+    }
+
+    /** @brief 전달된 포인터의 위치에 `val` 의 복사본 `count` 개를 생성한다.
+     *  @param alloc 객체를 생성할 할당자 인스턴스
+     *  @param ptr 객체를 생성할 위치를 가리키는 포인터
+     *  @param count 생성할 객체의 개수
+     *  @param val 복사할 값
+     *  @details trivially copyable 한 자료형은 할당자를 거치지 않고
+     *  `memset`/`memcpy` 로 채운다. 그 외의 자료형은 하나씩 생성하며, 예외가
+     *  발생하면 이미 생성된 객체들을 소멸시키고 다시 던진다.
+     */
+    static auto ConstructFill(Allocator_t& alloc, Value_t* ptr, Size_t count,
+                              const Value_t& val) -> void
+    {
+        if constexpr (std::is_trivially_copyable_v<Value_t>)
+        {
+            detail::fill_trivial(ptr, count, val);
+        }
+        else
+        {
+            Size_t i = 0;
+            try
+            {
+                for (; i < count; ++i)
+                    alloc.Construct(ptr + i, 1, val);
+            }
+            catch (...)
+            {
+                Deconstruct(alloc, ptr, i);
+                throw;
+            }
+        }
+    }
+
+    /** @brief `src` 의 객체 `count` 개를 `dst` 에 복사해서 생성한다.
+     *  @param alloc 객체를 생성할 할당자 인스턴스
+     *  @param dst 객체를 생성할 위치를 가리키는 포인터
+     *  @param src 복사할 객체들의 시작 주소. `dst` 와 겹치지 않아야 한다.
+     *  @param count 생성할 객체의 개수
+     *  @details trivially copyable 한 자료형은 `memcpy` 한 번으로 복사한다.
+     */
+    static auto ConstructCopy(Allocator_t& alloc, Value_t* dst,
+                              const Value_t* src, Size_t count) -> void
+    {
+        if constexpr (std::is_trivially_copyable_v<Value_t>)
+        {
+            if (count != 0)
+                std::memcpy(static_cast<void*>(dst),
+                            static_cast<const void*>(src),
+                            sizeof(Value_t) * count);
+        }
+        else
+        {
+            Size_t i = 0;
+            try
+            {
+                for (; i < count; ++i)
+                    alloc.Construct(dst + i, 1, src[i]);
+            }
+            catch (...)
+            {
+                Deconstruct(alloc, dst, i);
+                throw;
+            }
+        }
+    }
+
+    /** @brief `src` 의 객체 `count` 개를 `dst` 로 이동해서 생성한다. 원본은
+     *  소멸시키지 않는다.
+     *  @copydetails ConstructCopy
+     */
+    static auto ConstructMove(Allocator_t& alloc, Value_t* dst, Value_t* src,
+                              Size_t count) -> void
+    {
+        if constexpr (std::is_trivially_copyable_v<Value_t>)
+        {
+            if (count != 0)
+                std::memcpy(static_cast<void*>(dst),
+                            static_cast<const void*>(src),
+                            sizeof(Value_t) * count);
+        }
+        else
+        {
+            Size_t i = 0;
+            try
+            {
+                for (; i < count; ++i)
+                    alloc.Construct(dst + i, 1, std::move(src[i]));
+            }
+            catch (...)
+            {
+                Deconstruct(alloc, dst, i);
+                throw;
+            }
+        }
+    }
+
+    /** @overload
+     *  @note 기본 생성한 할당자를 사용하므로, 상태가 없는 할당자에만 사용한다.
+     */
+    template <class... CtorArgs_t>
+    static auto Construct(Value_t* ptr, Size_t count, CtorArgs_t&&... ctor_args)
+        -> void
+    {
+        Allocator_t alloc;
+        Construct(alloc, ptr, count, std::forward<CtorArgs_t>(ctor_args)...);
+    }
+
+    /** @overload
+     *  @note 기본 생성한 할당자를 사용하므로, 상태가 없는 할당자에만 사용한다.
      */
     static auto Deconstruct(const Value_t* ptr, Size_t count) -> void
     {
-        Allocator_t().Deconstruct(ptr, count);
+        Allocator_t alloc;
+        Deconstruct(alloc, ptr, count);
     }
 
     /// @} // Object Construction & Deconstruction
+
+    /// @{ @name Comparison
+public:
+    /** @brief 한 할당자로 할당한 메모리를 다른 할당자로 해제할 수 있는지
+     *  확인한다.
+     *  @return 상태가 없는 할당자는 항상 `true`, 그렇지 않으면 `operator==` 의
+     *  결과
+     */
+    static auto IsEqual(const Allocator_t& left, const Allocator_t& right)
+        -> bool
+    {
+        if constexpr (std::is_empty_v<Allocator_t>)
+            return true;
+        else
+            return left == right;
+    }
+
+    /// @} // Comparison
+};
+
+/** @brief 컨테이너가 할당자 인스턴스를 보관하기 위한 기반 클래스
+ *  @tparam __Alloc_t 보관할 할당자 자료형
+ *  @details
+ *  상태가 없는(빈) 할당자는 상속하여 빈 기반 클래스 최적화(EBO)를 적용하므로
+ *  컨테이너의 크기가 늘어나지 않는다. 상태가 있는 할당자는 멤버로 보관한다.
+ */
+template <class __Alloc_t,
+          bool = std::is_empty_v<__Alloc_t> && !std::is_final_v<__Alloc_t>>
+class AllocatorStorage: private __Alloc_t
+{
+protected:
+    AllocatorStorage() = default;
+
+    AllocatorStorage(const __Alloc_t& alloc)
+        : __Alloc_t(alloc)
+    {}
+
+    auto __Allocator() -> __Alloc_t& { return *this; }
+
+    auto __Allocator() const -> const __Alloc_t& { return *this; }
+};
+
+/** @copydoc AllocatorStorage */
+template <class __Alloc_t>
+class AllocatorStorage<__Alloc_t, false>
+{
+protected:
+    AllocatorStorage() = default;
+
+    AllocatorStorage(const __Alloc_t& alloc)
+        : m_allocator(alloc)
+    {}
+
+    auto __Allocator() -> __Alloc_t& { return m_allocator; }
+
+    auto __Allocator() const -> const __Alloc_t& { return m_allocator; }
+
+private:
+    __Alloc_t m_allocator{};
 };
 
 } // namespace rds
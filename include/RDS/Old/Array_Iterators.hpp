@@ -9,11 +9,11 @@ namespace rds
 
 /** @brief \ref Array 컨테이너에 대한 상수 반복자 템플릿 클래스
  *  @tparam __Array_t 이 상수 반복자가 가리킬 배열 자료형
- *  @details 임의 접근 반복자이다.
+ *  @details 연속 반복자이다.
  */
 template <class __Array_t>
 class Array_ConstIterator
-	: public Iterator< tag::RandomAccessIterator
+	: public Iterator< tag::ContiguosIterator_Tag
 						, typename __Array_t::Value_t
 						, typename __Array_t::Pointer_t
 						, typename __Array_t::Reference_t
@@ -24,7 +24,7 @@ public:
 
 	/// @{ @name Iterator Traits
 public:
-	using Iterator_t = Iterator< tag::RandomAccessIterator
+	using Iterator_t = Iterator< tag::ContiguosIterator_Tag
 							   , typename __Array_t::Value_t
 							   , typename __Array_t::Pointer_t
 							   , typename __Array_t::Reference_t
@@ -509,6 +509,9 @@ public:
 		return *this;
 	}
 
+	/** @brief 두 반복자 사이의 거리. 아래의 `operator-` 에 가려지지 않게 한다. */
+	using Super_t::operator-;
+
 	/** @copydoc Array_ConstIterator::operator-
 	 *
 	 */
@@ -43,7 +43,7 @@ namespace rds
  *  항상 존재한다.
  */
 template <class __T_t, template <class> class __Alloc_t = Nallocator>
-class ForwardList
+class ForwardList: private AllocatorStorage<__Alloc_t<Node_S<__T_t>>>
 {
 public:
     /** @brief 이 전방 리스트의 원소의 생성과 소멸을 관리하는 할당자 자료형이다.
@@ -55,6 +55,9 @@ public:
     using Size_t      = std::size_t;
     using Node_S_t    = Node_S<Value_t>;
 
+private:
+    using AllocatorStorage<Allocator_t>::__Allocator;
+
 public:
     using Value_t      = __T_t;
     using Pointer_t    = __T_t*;
@@ -163,10 +166,11 @@ public:
      *  @param[in] val 새로 생성될 노드에 들어갈 값
      *  @return 새로 생성된 노드의 주소
      */
-    static auto CreateNode(const Value_t& value) const -> Node_S_t*
+    auto CreateNode(const Value_t& value) -> Node_S_t*
     {
-        Node_S_t* ptr = AllocatorTraits<Allocator_t>::Allocate(1);
-        AllocatorTraits<Allocator_t>::Construct(ptr, 1, value);
+        Node_S_t* ptr =
+            AllocatorTraits<Allocator_t>::Allocate(__Allocator(), 1);
+        AllocatorTraits<Allocator_t>::Construct(__Allocator(), ptr, 1, value);
 
         return ptr;
     }
@@ -180,20 +184,21 @@ public:
      *  @note \ref Node_S 의 연관된 생성자를 호출한다.
      */
     template <class..__CtorArgs_t>
-    static auto CreateNode(__CtorArgs_t&&... ctor_args) -> Node_S_t*
+    auto CreateNode(__CtorArgs_t&&... ctor_args) -> Node_S_t*
     {
-        Node_S_t* ptr = AllocatorTraits<Allocator_t>::Allocate(1);
+        Node_S_t* ptr =
+            AllocatorTraits<Allocator_t>::Allocate(__Allocator(), 1);
         AllocatorTraits<Allocator_t>::Construct(
-            ptr, 1, std::forward<__CtorArgs_t>(ctor_args)...);
+            __Allocator(), ptr, 1, std::forward<__CtorArgs_t>(ctor_args)...);
     }
 
     /** @brief 전달된 포인터에 있는 노드를 삭제한다.
      *  @param[in] node_ptr 삭제할 노드의 주소
      */
-    static auto DeleteNode(const Node_S_t* node) const -> void
+    auto DeleteNode(const Node_S_t* node) -> void
     {
-        AllocatorTraits<Allocator_t>::Deconstruct(node, 1);
-        AllocatorTraits<Allocator_t>::Deallocate(node);
+        AllocatorTraits<Allocator_t>::Deconstruct(__Allocator(), node, 1);
+        AllocatorTraits<Allocator_t>::Deallocate(__Allocator(), node, 1);
     }
 
     /// @} // Node Management
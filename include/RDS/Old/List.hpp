@@ -52,7 +52,7 @@ namespace rds
  *  존재한다.
  */
 template <class __T_t, template <class> class __Alloc_t = Nallocator>
-class List
+class List: private AllocatorStorage<__Alloc_t<Node_D<__T_t>>>
 {
 public:
     /** @brief 이 리스트의 원소의 생성과 소멸을 관리하는 할당자 자료형이다.
@@ -64,6 +64,9 @@ public:
     using Size_t      = std::size_t;
     using Node_D_t    = Node_D<__T_t>;
 
+private:
+    using AllocatorStorage<Allocator_t>::__Allocator;
+
 public:
     using Value_t      = __T_t;
     using Pointer_t    = __T_t*;
@@ -82,13 +85,23 @@ public:
      */
     List() { __InitializeSentinelNode(); }
 
+    /** @brief 할당자를 지정하는 생성자
+     *  @param[in] alloc 노드를 할당할 할당자. 상태를 가지는 할당자(예: 풀)를
+     *  리스트마다 따로 지정할 수 있다.
+     */
+    explicit List(const Allocator_t& alloc)
+        : AllocatorStorage<Allocator_t>(alloc)
+    {
+        __InitializeSentinelNode();
+    }
+
     /** @brief 복사 생성자
      *  @param[in] other 복사할 다른 리스트
-     *  @details 다른 리스트의 값을 순회하며 이 리스트에 `PushBack` 으로
-     *  복사한다.
+     *  @details 다른 리스트의 할당자를 복사한 뒤, 다른 리스트의 값을 순회하며
+     *  이 리스트에 `PushBack` 으로 복사한다.
      */
     List(const List& other)
-        : List()
+        : List(other.__Allocator())
     {
         // Prevents shallow copy
         for (auto it = other.CBegin(); it != other.CEnd(); ++it)
@@ -101,7 +114,7 @@ public:
      *  노드 이후에 있는 노드들을 이 리스트로 이동시킨다.
      */
     List(List&& temp_other)
-        : List()
+        : List(temp_other.__Allocator())
     {
         operator=(static_cast<List&&>(temp_other));
         // named rvalue ref considered as lvalue so we fucking need to
@@ -134,6 +147,7 @@ public:
      *  @param[in] temp_other 이동하여 이 리스트에 대입할 다른 리스트
      *  @return 연산 이후 이 리스트에 대한 참조
      *  @details 우선 이 리스트의 모든 노드들을 \ref Clear 를 이용해 삭제한다.
+     *  노드들과 함께 다른 리스트의 할당자도 이 리스트로 옮겨온다.
      */
     auto operator=(List&& temp_other) -> List&
     {
@@ -158,6 +172,9 @@ public:
 
         Clear();
 
+        // 노드들을 해제할 수 있도록 할당자도 함께 옮겨온다.
+        __Allocator() = temp_other.__Allocator();
+
         // `temp_other`가 비어있으면 앞으로 나올 로직이 고장난다.
         if (temp_other.m_size == 0)
             return *this;
@@ -194,12 +211,13 @@ public:
      *  @param[in] size 생성할 리스트의 크기
      *  @param[in] init_val 생성할 리스트의 초기값.
      *  @details `size` 가 0이면, `init_val`에 상관없이 아무 동작도 하지 않는다.
+     *  노드들을 먼저 연결한 뒤 리스트에는 한 번에 붙인다
+     *  (\ref InsertBefore(ConstIterator_t, Size_t, const Value_t&)).
      */
     List(Size_t size, const Value_t& init_val = Value_t())
         : List()
     {
-        for (Size_t i = 0; i < size; ++i)
-            PushBack(init_val);
+        InsertBefore(CEnd(), size, init_val);
     }
 
     /** @brief 초기화 리스트를 받는 생성자
@@ -247,10 +265,11 @@ public:
      *  @param[in] val 새로 생성될 노드에 들어갈 값
      *  @return 새로 생성된 노드의 주소
      */
-    static auto CreateNode(const Value_t& val) -> Node_D_t*
+    auto CreateNode(const Value_t& val) -> Node_D_t*
     {
-        Node_D_t* ptr = AllocatorTraits<Allocator_t>::Allocate(1);
-        AllocatorTraits<Allocator_t>::Construct(ptr, 1, val);
+        Node_D_t* ptr =
+            AllocatorTraits<Allocator_t>::Allocate(__Allocator(), 1);
+        AllocatorTraits<Allocator_t>::Construct(__Allocator(), ptr, 1, val);
 
         return ptr;
     }
@@ -264,11 +283,12 @@ public:
      *  @note \ref Node_D 의 연관된 생성자를 호출한다.
      */
     template <class... __CtorArgs_t>
-    static auto CreateNode(__CtorArgs_t&&... ctor_args) -> Node_D_t*
+    auto CreateNode(__CtorArgs_t&&... ctor_args) -> Node_D_t*
     {
-        Node_D_t* ptr = AllocatorTraits<Allocator_t>::Allocate(1);
+        Node_D_t* ptr =
+            AllocatorTraits<Allocator_t>::Allocate(__Allocator(), 1);
         AllocatorTraits<Allocator_t>::Construct(
-            ptr, 1, std::forward<__CtorArgs_t>(ctor_args)...);
+            __Allocator(), ptr, 1, std::forward<__CtorArgs_t>(ctor_args)...);
 
         return ptr;
     }
@@ -276,12 +296,15 @@ public:
     /** @brief 전달된 포인터에 있는 노드를 삭제한다.
      *  @param[in] node_ptr 삭제할 노드의 주소
      */
-    static auto DeleteNode(const Node_D_t* node_ptr) -> void
+    auto DeleteNode(const Node_D_t* node_ptr) -> void
     {
-        AllocatorTraits<Allocator_t>::Deconstruct(node_ptr, 1);
-        AllocatorTraits<Allocator_t>::Deallocate(node_ptr);
+        AllocatorTraits<Allocator_t>::Deconstruct(__Allocator(), node_ptr, 1);
+        AllocatorTraits<Allocator_t>::Deallocate(__Allocator(), node_ptr, 1);
     }
 
+    /** @brief 이 리스트가 사용하는 할당자의 사본을 반환한다. */
+    auto GetAllocator() const -> Allocator_t { return __Allocator(); }
+
     /// @} // Node Management
 
     /// @{  @name Access
@@ -513,15 +536,30 @@ public:
         Node_D_t* new_node_ptr_head = CreateNode(val);
         auto*     new_node_ptr_tail = new_node_ptr_head;
 
-        // 새로운 노드들을 생성하고 연결한다.
-        for (Size_t i = 1; i < count; ++i)
+        // 새로운 노드들을 생성하고 연결한다. 생성 중 예외가 발생하면 지금까지
+        // 만든 노드들을 정리하고 리스트는 그대로 둔다.
+        try
         {
-            Node_D_t* new_node_ptr = CreateNode(val);
+            for (Size_t i = 1; i < count; ++i)
+            {
+                Node_D_t* new_node_ptr = CreateNode(val);
 
-            new_node_ptr_tail->next = new_node_ptr;
-            new_node_ptr->prev      = new_node_ptr_tail;
+                new_node_ptr_tail->next = new_node_ptr;
+                new_node_ptr->prev      = new_node_ptr_tail;
 
-            new_node_ptr_tail = new_node_ptr;
+                new_node_ptr_tail = new_node_ptr;
+            }
+        }
+        catch (...)
+        {
+            while (new_node_ptr_head != new_node_ptr_tail)
+            {
+                auto* next = new_node_ptr_head->next;
+                DeleteNode(new_node_ptr_head);
+                new_node_ptr_head = next;
+            }
+            DeleteNode(new_node_ptr_tail);
+            throw;
         }
 
         // 연결된 새 노드들을 이제 리스트의 올바른 위치에 연결한다.
@@ -814,6 +852,11 @@ public:
         auto temp_size = m_size;
         m_size         = other.m_size;
         other.m_size   = temp_size;
+
+        // 노드들을 따라 할당자도 바꿔준다
+        auto temp_alloc     = __Allocator();
+        __Allocator()       = other.__Allocator();
+        other.__Allocator() = temp_alloc;
     }
 
     /** @brief 컨테이너가 `count` 개수의 원소를 가지도록 크기를 변경한다.
@@ -917,6 +960,11 @@ public:
         RDS_Assert(other_it_last.IsValid() && "End of range is not valid.");
         RDS_Assert(other_it_last.IsCompatible(other) &&
                    "List is not compatible.");
+        // 4) 할당자 검사
+        // - 옮겨온 노드를 이 리스트의 할당자로 해제할 수 있어야 함
+        RDS_Assert(AllocatorTraits<Allocator_t>::IsEqual(
+                       __Allocator(), other.__Allocator()) &&
+                   "Allocators are not equal.");
         // clang-format off
 /*
 --------------------------------------------------------------------------------
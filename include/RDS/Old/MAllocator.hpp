@@ -55,6 +55,15 @@ public:
         free(const_cast<void*>(static_cast<const void*>(ptr)));
     }
 
+    /** @copydoc AllocatorTraits::Deallocate(Allocator_t&, const Value_t*, Size_t)
+     *
+     *  @note `free` 는 크기를 받지 않으므로 `count` 는 사용하지 않는다.
+     */
+    auto Deallocate(const Value_t* ptr, Size_t /*count*/) -> void
+    {
+        Deallocate(ptr);
+    }
+
     /// @} // Memory Allocation & Deallocation
 
     /// @{ @name Object Construction & Deconstruction
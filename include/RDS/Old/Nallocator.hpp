@@ -37,7 +37,17 @@ public:
         return ptr;
     }
 
-    /** @copydoc AllocatorTraits::Deallocate */
+    /** @copydoc AllocatorTraits::Deallocate(Allocator_t&, const Value_t*, Size_t)
+     *
+     *  @note 크기를 받는 `::operator delete` 로 넘기므로, 전역 할당기가 크기
+     *  등급을 다시 찾지 않아도 된다.
+     */
+    auto Deallocate(const Value_t* ptr, Size_t count) -> void
+    {
+        ::operator delete(const_cast<Value_t*>(ptr), sizeof(Value_t) * count);
+    }
+
+    /** @copydoc AllocatorTraits::Deallocate(Allocator_t&, const Value_t*) */
     auto Deallocate(const Value_t* ptr) -> void
     {
         ::operator delete(const_cast<Value_t*>(ptr));
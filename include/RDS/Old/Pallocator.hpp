@@ -0,0 +1,239 @@
+#ifndef RDS_PALLOCATOR_HPP
+#define RDS_PALLOCATOR_HPP
+
+#include <new>
+#include <utility> // std::forward
+
+#include "Assertion.h"
+#include "RDS_CoreDefs.h"
+
+namespace rds
+{
+
+/** @brief 같은 크기의 노드를 큰 블록 단위로 받아와 잘라주는 고정 크기 메모리 풀
+ *  @tparam __T_t 풀에서 할당할 노드의 자료형
+ *  @details
+ *  블록 하나에는 `SlotsPerBlock` 개의 슬롯이 연속으로 들어있으며, 반환된 슬롯은
+ *  슬롯 자신의 메모리를 링크로 사용하는 침습형(intrusive) 자유 리스트에 보관된다.
+ *  새 블록의 슬롯은 주소 순서대로 자유 리스트에 연결되므로, 연속해서 할당된
+ *  노드들은 메모리 상에서도 인접하게 된다. 블록은 풀이 소멸될 때 한 번에
+ *  해제된다.
+ *
+ *  @warning 스레드 안전하지 않다.
+ */
+template <class __T_t>
+class NodePool
+{
+public:
+    using Value_t = __T_t;
+    using Size_t  = std::size_t;
+
+private:
+    /** @brief 비어있을 때는 다음 슬롯을 가리키고, 사용 중일 때는 노드를 담는
+     *  슬롯 */
+    union Slot
+    {
+        Slot* next;
+        alignas(Value_t) unsigned char storage[sizeof(Value_t)];
+    };
+
+public:
+    /** @brief 블록 하나에 들어가는 슬롯의 개수 (블록 하나는 약 64KiB) */
+    static constexpr Size_t SlotsPerBlock =
+        sizeof(Slot) < 65536 ? 65536 / sizeof(Slot) : 1;
+
+private:
+    struct Block
+    {
+        Block* next;
+        Slot   slots[SlotsPerBlock];
+    };
+
+public:
+    NodePool()                           = default;
+    NodePool(const NodePool&)            = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /** @brief 소멸자. 풀이 보유한 모든 블록을 해제한다. */
+    ~NodePool()
+    {
+        while (m_block_head != nullptr)
+        {
+            Block* next = m_block_head->next;
+            delete m_block_head;
+            m_block_head = next;
+        }
+    }
+
+    /** @brief 자료형 `__T_t` 에 대해 공유되는 풀을 반환한다. */
+    static auto Get() -> NodePool&
+    {
+        static NodePool pool;
+        return pool;
+    }
+
+public:
+    /** @brief 노드 하나 크기의 메모리를 할당한다.
+     *  @return 할당된 메모리의 시작 주소
+     *  @details 자유 리스트가 비어있으면 새 블록을 받아와 자유 리스트를
+     *  채운다.
+     */
+    auto Pop() -> Value_t*
+    {
+        if (m_free_head == nullptr)
+            __AddBlock();
+
+        Slot* slot  = m_free_head;
+        m_free_head = slot->next;
+        return reinterpret_cast<Value_t*>(slot->storage);
+    }
+
+    /** @brief 노드 하나 크기의 메모리를 풀에 반환한다. O(1)
+     *  @param[in] ptr \ref Pop 으로 할당된 메모리의 시작 주소
+     */
+    auto Push(const Value_t* ptr) -> void
+    {
+        auto* slot  = reinterpret_cast<Slot*>(const_cast<Value_t*>(ptr));
+        slot->next  = m_free_head;
+        m_free_head = slot;
+    }
+
+    /** @brief 풀이 상위 할당자로부터 받아온 블록의 개수를 반환한다. */
+    auto BlockCount() const -> Size_t { return m_block_count; }
+
+private:
+    auto __AddBlock() -> void
+    {
+        auto* block  = new Block;
+        block->next  = m_block_head;
+        m_block_head = block;
+        ++m_block_count;
+
+        // 주소 순서대로 할당되도록 뒤에서부터 연결한다.
+        for (Size_t i = SlotsPerBlock; i > 0; --i)
+        {
+            block->slots[i - 1].next = m_free_head;
+            m_free_head              = &block->slots[i - 1];
+        }
+    }
+
+private:
+    Slot*  m_free_head{nullptr};
+    Block* m_block_head{nullptr};
+    Size_t m_block_count{0};
+};
+
+/** @brief 노드를 \ref NodePool 에서 잘라서 할당하는 메모리 할당자
+ *  @tparam __T_t 할당할 메모리의 자료형 (리스트의 노드)
+ *  @details
+ *  \ref List, \ref ForwardList 의 `__Alloc_t` 템플릿 템플릿 인자로 사용하면
+ *  노드마다 전역 할당자를 호출하지 않고, 풀에서 노드를 할당한다. 기본 생성하면
+ *  자료형마다 공유되는 풀(\ref NodePool::Get)을 사용하며, 풀을 지정해 생성하면
+ *  그 풀을 사용한다.
+ *
+ *  `count` 가 1이 아닌 할당은 풀을 거치지 않고 `::operator new` 로 넘긴다.
+ *  해제할 때 크기를 알아야 구분할 수 있으므로, 그런 메모리는 반드시 크기를
+ *  받는 \ref Deallocate 로 해제해야 한다.
+ *
+ *  @warning 스레드 안전하지 않다.
+ */
+template <class __T_t>
+class Pallocator
+{
+public:
+    using Value_t      = __T_t;
+    using Size_t       = std::size_t;
+    using Difference_t = std::ptrdiff_t;
+
+public:
+    Pallocator()                  = default;
+    Pallocator(const Pallocator&) = default;
+    ~Pallocator()                 = default;
+
+    /** @brief 지정한 풀에서 노드를 할당하는 할당자를 생성한다.
+     *  @param[in] pool 노드를 할당할 풀. 이 할당자를 사용하는 컨테이너보다
+     *  오래 살아야 한다.
+     */
+    explicit Pallocator(NodePool<Value_t>& pool)
+        : m_pool(&pool)
+    {}
+
+    /** @brief 같은 풀을 사용하는 할당자인지 비교한다. */
+    auto operator==(const Pallocator& other) const -> bool
+    {
+        return m_pool == other.m_pool;
+    }
+
+    /// @{ @name Memory Allocation & Deallocation
+public:
+    /** @copydoc AllocatorTraits::Allocate
+     *
+     *  @exception 풀 밖의 할당이 실패한 경우 `std::bad_alloc`
+     */
+    auto Allocate(Size_t count) -> Value_t*
+    {
+        if (count != 1)
+        {
+            return static_cast<Value_t*>(
+                ::operator new(sizeof(Value_t) * count));
+        }
+
+        return m_pool->Pop();
+    }
+
+    /** @copydoc AllocatorTraits::Deallocate(Allocator_t&, const Value_t*, Size_t)
+     */
+    auto Deallocate(const Value_t* ptr, Size_t count) -> void
+    {
+        if (ptr == nullptr)
+            return;
+
+        if (count != 1)
+        {
+            ::operator delete(const_cast<Value_t*>(ptr),
+                              sizeof(Value_t) * count);
+            return;
+        }
+
+        m_pool->Push(ptr);
+    }
+
+    /** @copydoc AllocatorTraits::Deallocate(Allocator_t&, const Value_t*)
+     *
+     *  @note 노드 하나를 할당한 메모리에만 사용한다.
+     */
+    auto Deallocate(const Value_t* ptr) -> void { Deallocate(ptr, 1); }
+
+    /// @} // Memory Allocation & Deallocation
+
+    /// @{ @name Object Construction & Deconstruction
+public:
+    /** @copydoc AllocatorTraits::Construct */
+    template <class... __CtorArgs_t>
+    auto Construct(Value_t* ptr, Size_t count, __CtorArgs_t&&... ctor_args)
+        -> void
+    {
+        for (Size_t i = 0; i < count; ++i)
+        {
+            ::new (ptr + i) Value_t(std::forward<__CtorArgs_t>(ctor_args)...);
+        }
+    }
+
+    /** @copydoc AllocatorTraits::Deconstruct */
+    auto Deconstruct(const Value_t* ptr, Size_t count) -> void
+    {
+        for (Size_t i = 0; i < count; ++i)
+        {
+            (ptr + i)->~Value_t();
+        }
+    }
+
+    /// @} // Object Construction & Deconstruction
+
+private:
+    NodePool<Value_t>* m_pool{&NodePool<Value_t>::Get()};
+};
+
+} // namespace rds
+
+#endif // RDS_PALLOCATOR_HPP
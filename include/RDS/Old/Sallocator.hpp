@@ -0,0 +1,113 @@
+#ifndef RDS_SALLOCATOR_HPP
+#define RDS_SALLOCATOR_HPP
+
+#include <cstddef>
+#include <utility> // std::forward
+
+#include "Assertion.h"
+#include "Nallocator.hpp"
+#include "RDS_CoreDefs.h"
+
+#include "../tracking_allocator.h"
+
+namespace rds
+{
+
+/** @brief 다른 할당자를 감싸서 할당 통계를 \ref alloc_tracker 에 기록하는
+ *  메모리 할당자
+ *  @tparam __T_t 할당할 메모리의 자료형
+ *  @tparam __Base_t 실제 할당을 수행할 할당자 (\ref Nallocator, \ref Mallocator
+ *  등)
+ *  @details
+ *  해제한 크기는 크기를 받는 \ref AllocatorTraits::Deallocate 에서 얻으므로
+ *  크기 없이는 해제할 수 없다. 해제는 해제하는 할당자의 태그로 기록되므로,
+ *  태그별 사용량을 보려면 같은 할당자로 할당하고 해제해야 한다. 컨테이너는
+ *  자신이 보관한 할당자를 사용하므로 이 조건을 만족한다.
+ *  스레드 카운터가 소멸한 뒤(정적 컨테이너의 소멸자 등)의 기록은 전역
+ *  카운터로 넘어가므로 안전하다.
+ */
+template <class __T_t, template <class> class __Base_t = Nallocator>
+class Sallocator
+{
+public:
+    using Value_t      = __T_t;
+    using Size_t       = std::size_t;
+    using Difference_t = std::ptrdiff_t;
+    using Base_t       = __Base_t<__T_t>;
+
+public:
+    Sallocator()                  = default;
+    Sallocator(const Sallocator&) = default;
+    ~Sallocator()                 = default;
+
+    /** @brief 할당을 \p tag 번 태그(\ref alloc_tracker::tag)로 기록하는
+     *  할당자를 생성한다.
+     */
+    explicit Sallocator(Size_t tag)
+        : m_tag(tag)
+    {}
+
+    /** @brief 모든 `Sallocator` 는 서로의 메모리를 해제할 수 있다. */
+    auto operator==(const Sallocator&) const -> bool { return true; }
+
+    auto GetTag() const -> Size_t { return m_tag; }
+
+    /// @{ @name Memory Allocation & Deallocation
+public:
+    /** @copydoc AllocatorTraits::Allocate
+     *
+     *  @exception 할당이 실패한 경우 `__Base_t` 가 던지는 예외
+     */
+    auto Allocate(Size_t count) -> Value_t*
+    {
+        Value_t* ptr = m_base.Allocate(count);
+        alloc_tracker::on_allocate(sizeof(Value_t) * count, m_tag);
+
+        return ptr;
+    }
+
+    /** @copydoc AllocatorTraits::Deallocate(Allocator_t&, const Value_t*, Size_t)
+     */
+    auto Deallocate(const Value_t* ptr, Size_t count) -> void
+    {
+        if (ptr == nullptr)
+            return;
+
+        alloc_tracker::on_deallocate(sizeof(Value_t) * count, m_tag);
+        m_base.Deallocate(ptr, count);
+    }
+
+    /// @} // Memory Allocation & Deallocation
+
+    /// @{ @name Object Construction & Deconstruction
+public:
+    /** @copydoc AllocatorTraits::Construct */
+    template <class... __CtorArgs_t>
+    auto Construct(Value_t* ptr, Size_t count, __CtorArgs_t&&... ctor_args)
+        -> void
+    {
+        for (Size_t i = 0; i < count; ++i)
+        {
+            ::new (ptr + i) Value_t(std::forward<__CtorArgs_t>(ctor_args)...);
+        }
+    }
+
+    /** @copydoc AllocatorTraits::Deconstruct */
+    auto Deconstruct(const Value_t* ptr, Size_t count) -> void
+    {
+        for (Size_t i = 0; i < count; ++i)
+        {
+            (ptr + i)->~Value_t();
+        }
+    }
+
+    /// @} // Object Construction & Deconstruction
+
+private:
+    Base_t m_base{};
+    Size_t m_tag = 0;
+};
+
+} // namespace rds
+
+#endif // RDS_SALLOCATOR_HPP
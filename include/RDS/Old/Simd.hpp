@@ -0,0 +1,529 @@
+#ifndef RDS_SIMD_HPP
+#define RDS_SIMD_HPP
+
+#include "RDS_CoreDefs.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(_M_X64))
+#define RDS_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(RDS_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define RDS_SIMD_AVX2 1
+#define RDS_TARGET_AVX2 __attribute__((target("avx2")))
+#define RDS_TARGET_AVX2_INLINE __attribute__((target("avx2"), always_inline))
+#endif
+
+namespace rds::simd
+{
+
+using Size_t = std::size_t;
+
+/** @brief 벡터화한 커널이 다루는 레인(lane)의 자료형
+ *  @details 정수는 크기가 같은 부호 있는 정수로, 실수는 그대로 다룬다. 그 외의 자료형은 `void` 이다.
+ *  같은지 비교할 때는 비트 표현만 보므로 부호 없는 정수도 같은 레인을 쓴다.
+ */
+template <class __T_t>
+using Lane_t = std::conditional_t<
+    std::is_same_v<__T_t, float> || std::is_same_v<__T_t, double>, __T_t,
+    std::conditional_t<std::is_integral_v<__T_t> && !std::is_same_v<__T_t, bool> && sizeof(__T_t) == 4, std::int32_t,
+                       std::conditional_t<std::is_integral_v<__T_t> && !std::is_same_v<__T_t, bool> && sizeof(__T_t) == 8,
+                                          std::int64_t, void>>>;
+
+/** @brief \ref Find, \ref Count 를 벡터화할 수 있는 자료형인지 여부 */
+template <class __T_t>
+inline constexpr bool IsEqualityVectorizable_v = !std::is_void_v<Lane_t<__T_t>>;
+
+/** @brief \ref MinMaxIndex 를 벡터화할 수 있는 자료형인지 여부
+ *  @note 대소 비교는 부호가 있는 32비트 정수와 실수만 지원한다. (SSE2에는 64비트 정수 비교가 없다)
+ */
+template <class __T_t>
+inline constexpr bool IsOrderVectorizable_v =
+    std::is_same_v<__T_t, std::int32_t> || std::is_same_v<__T_t, float> || std::is_same_v<__T_t, double>;
+
+/** @brief \ref MinMaxIndex 가 NaN을 만났음을 나타내는 반환값 */
+inline constexpr Size_t NanFound_v = static_cast<Size_t>(-1);
+
+#if defined(RDS_SIMD_X86)
+
+namespace impl
+{
+
+/** @brief 레인 자료형별 SSE2 연산
+ *  @details 모든 x86-64 CPU가 SSE2를 지원하므로 별도의 대상 지정이 필요 없다.
+ */
+template <class __Lane_t>
+struct Sse2;
+
+template <>
+struct Sse2<std::int32_t>
+{
+    using Reg_t                          = __m128i;
+    static constexpr Size_t Lanes        = 4;
+
+    static auto Load(const std::int32_t* p) -> Reg_t { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static auto Set1(std::int32_t v) -> Reg_t { return _mm_set1_epi32(v); }
+    static auto Store(std::int32_t* p, Reg_t v) -> void { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static auto EqMask(Reg_t a, Reg_t b) -> unsigned
+    {
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+    }
+    static auto NanMask(Reg_t) -> unsigned { return 0; }
+    static auto Min(Reg_t a, Reg_t b) -> Reg_t
+    {
+        const __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+    }
+    static auto Max(Reg_t a, Reg_t b) -> Reg_t
+    {
+        const __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+    }
+    /** @brief 64비트 절반끼리 / 이웃한 레인끼리 자리를 바꾼다. 레지스터 안에서 줄일(reduce) 때 쓴다. */
+    static auto SwapHalves(Reg_t a) -> Reg_t { return _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)); }
+    static auto SwapPairs(Reg_t a) -> Reg_t { return _mm_shuffle_epi32(a, _MM_SHUFFLE(2, 3, 0, 1)); }
+};
+
+template <>
+struct Sse2<std::int64_t>
+{
+    using Reg_t                          = __m128i;
+    static constexpr Size_t Lanes        = 2;
+
+    static auto Load(const std::int64_t* p) -> Reg_t { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static auto Set1(std::int64_t v) -> Reg_t { return _mm_set1_epi64x(v); }
+    static auto EqMask(Reg_t a, Reg_t b) -> unsigned
+    {
+        // 32비트 절반이 둘 다 같아야 64비트가 같다.
+        const __m128i eq = _mm_cmpeq_epi32(a, b);
+        return _mm_movemask_pd(_mm_castsi128_pd(_mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)))));
+    }
+};
+
+template <>
+struct Sse2<float>
+{
+    using Reg_t                          = __m128;
+    static constexpr Size_t Lanes        = 4;
+
+    static auto Load(const float* p) -> Reg_t { return _mm_loadu_ps(p); }
+    static auto Set1(float v) -> Reg_t { return _mm_set1_ps(v); }
+    static auto Store(float* p, Reg_t v) -> void { _mm_storeu_ps(p, v); }
+    static auto EqMask(Reg_t a, Reg_t b) -> unsigned { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    static auto NanMask(Reg_t a) -> unsigned { return _mm_movemask_ps(_mm_cmpunord_ps(a, a)); }
+    static auto Min(Reg_t a, Reg_t b) -> Reg_t { return _mm_min_ps(a, b); }
+    static auto Max(Reg_t a, Reg_t b) -> Reg_t { return _mm_max_ps(a, b); }
+    static auto SwapHalves(Reg_t a) -> Reg_t { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 3, 2)); }
+    static auto SwapPairs(Reg_t a) -> Reg_t { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }
+};
+
+template <>
+struct Sse2<double>
+{
+    using Reg_t                          = __m128d;
+    static constexpr Size_t Lanes        = 2;
+
+    static auto Load(const double* p) -> Reg_t { return _mm_loadu_pd(p); }
+    static auto Set1(double v) -> Reg_t { return _mm_set1_pd(v); }
+    static auto Store(double* p, Reg_t v) -> void { _mm_storeu_pd(p, v); }
+    static auto EqMask(Reg_t a, Reg_t b) -> unsigned { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+    static auto NanMask(Reg_t a) -> unsigned { return _mm_movemask_pd(_mm_cmpunord_pd(a, a)); }
+    static auto Min(Reg_t a, Reg_t b) -> Reg_t { return _mm_min_pd(a, b); }
+    static auto Max(Reg_t a, Reg_t b) -> Reg_t { return _mm_max_pd(a, b); }
+    static auto SwapHalves(Reg_t a) -> Reg_t { return _mm_shuffle_pd(a, a, 1); }
+};
+
+#if defined(RDS_SIMD_AVX2)
+
+/** @brief 레인 자료형별 AVX2 연산
+ *  @details 이 함수들은 AVX2를 대상으로 컴파일한 커널 안에서만 인라인된다.
+ */
+template <class __Lane_t>
+struct Avx2;
+
+template <>
+struct Avx2<std::int32_t>
+{
+    using Reg_t                          = __m256i;
+    static constexpr Size_t Lanes        = 8;
+
+    RDS_TARGET_AVX2_INLINE static auto Load(const std::int32_t* p) -> Reg_t
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    RDS_TARGET_AVX2_INLINE static auto Set1(std::int32_t v) -> Reg_t { return _mm256_set1_epi32(v); }
+    RDS_TARGET_AVX2_INLINE static auto Store(std::int32_t* p, Reg_t v) -> void
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    RDS_TARGET_AVX2_INLINE static auto EqMask(Reg_t a, Reg_t b) -> unsigned
+    {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+    }
+    RDS_TARGET_AVX2_INLINE static auto NanMask(Reg_t) -> unsigned { return 0; }
+    RDS_TARGET_AVX2_INLINE static auto Min(Reg_t a, Reg_t b) -> Reg_t { return _mm256_min_epi32(a, b); }
+    RDS_TARGET_AVX2_INLINE static auto Max(Reg_t a, Reg_t b) -> Reg_t { return _mm256_max_epi32(a, b); }
+};
+
+template <>
+struct Avx2<std::int64_t>
+{
+    using Reg_t                          = __m256i;
+    static constexpr Size_t Lanes        = 4;
+
+    RDS_TARGET_AVX2_INLINE static auto Load(const std::int64_t* p) -> Reg_t
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    RDS_TARGET_AVX2_INLINE static auto Set1(std::int64_t v) -> Reg_t { return _mm256_set1_epi64x(v); }
+    RDS_TARGET_AVX2_INLINE static auto EqMask(Reg_t a, Reg_t b) -> unsigned
+    {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+    }
+};
+
+template <>
+struct Avx2<float>
+{
+    using Reg_t                          = __m256;
+    static constexpr Size_t Lanes        = 8;
+
+    RDS_TARGET_AVX2_INLINE static auto Load(const float* p) -> Reg_t { return _mm256_loadu_ps(p); }
+    RDS_TARGET_AVX2_INLINE static auto Set1(float v) -> Reg_t { return _mm256_set1_ps(v); }
+    RDS_TARGET_AVX2_INLINE static auto Store(float* p, Reg_t v) -> void { _mm256_storeu_ps(p, v); }
+    RDS_TARGET_AVX2_INLINE static auto EqMask(Reg_t a, Reg_t b) -> unsigned
+    {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+    }
+    RDS_TARGET_AVX2_INLINE static auto NanMask(Reg_t a) -> unsigned
+    {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, a, _CMP_UNORD_Q));
+    }
+    RDS_TARGET_AVX2_INLINE static auto Min(Reg_t a, Reg_t b) -> Reg_t { return _mm256_min_ps(a, b); }
+    RDS_TARGET_AVX2_INLINE static auto Max(Reg_t a, Reg_t b) -> Reg_t { return _mm256_max_ps(a, b); }
+};
+
+template <>
+struct Avx2<double>
+{
+    using Reg_t                          = __m256d;
+    static constexpr Size_t Lanes        = 4;
+
+    RDS_TARGET_AVX2_INLINE static auto Load(const double* p) -> Reg_t { return _mm256_loadu_pd(p); }
+    RDS_TARGET_AVX2_INLINE static auto Set1(double v) -> Reg_t { return _mm256_set1_pd(v); }
+    RDS_TARGET_AVX2_INLINE static auto Store(double* p, Reg_t v) -> void { _mm256_storeu_pd(p, v); }
+    RDS_TARGET_AVX2_INLINE static auto EqMask(Reg_t a, Reg_t b) -> unsigned
+    {
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+    }
+    RDS_TARGET_AVX2_INLINE static auto NanMask(Reg_t a) -> unsigned
+    {
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, a, _CMP_UNORD_Q));
+    }
+    RDS_TARGET_AVX2_INLINE static auto Min(Reg_t a, Reg_t b) -> Reg_t { return _mm256_min_pd(a, b); }
+    RDS_TARGET_AVX2_INLINE static auto Max(Reg_t a, Reg_t b) -> Reg_t { return _mm256_max_pd(a, b); }
+};
+
+#endif // RDS_SIMD_AVX2
+
+/** @brief 최솟값/최댓값을 찾을 때 한 번에 줄이는(reduce) 블록의 원소 수
+ *  @details 블록마다 최솟값만 비교하고, 마지막에 가장 좋은 블록 하나만 다시 훑어서 위치를 찾는다.
+ */
+inline constexpr Size_t MinMaxBlock_v = 1024;
+
+// 아래 커널들은 SSE2 판과 AVX2 판의 본문이 같다. GCC는 대상이 다른 함수를 인라인하지 않으므로,
+// 커널 자체에 대상을 지정해서 연산 구조체의 함수들이 커널 안에 인라인되게 한다.
+
+template <class __Lane_t>
+inline auto FindTail(const __Lane_t* p, Size_t i, Size_t n, __Lane_t val) -> Size_t
+{
+    for (; i < n; ++i)
+        if (p[i] == val)
+            return i;
+    return n;
+}
+
+template <class __Lane_t>
+inline auto CountTail(const __Lane_t* p, Size_t i, Size_t n, __Lane_t val) -> Size_t
+{
+    Size_t c = 0;
+    for (; i < n; ++i)
+        c += p[i] == val;
+    return c;
+}
+
+/** @brief 블록 하나의 최솟값(최댓값)을 구한다. NaN이 있으면 `nan` 을 true 로 바꾼다.
+ */
+template <bool __IsMax_v, class __Lane_t>
+inline auto ReduceLanes(const __Lane_t* lanes, Size_t count, const __Lane_t* p, Size_t i, Size_t n, bool& nan)
+    -> __Lane_t
+{
+    __Lane_t m = lanes[0];
+    for (Size_t l = 1; l < count; ++l)
+        m = (__IsMax_v ? m < lanes[l] : lanes[l] < m) ? lanes[l] : m;
+    for (; i < n; ++i)
+    {
+        nan |= p[i] != p[i];
+        m = (__IsMax_v ? m < p[i] : p[i] < m) ? p[i] : m;
+    }
+    return m;
+}
+
+/** @brief 가장 좋은 블록에서 \p best 가 처음 나오는 위치를 찾는다. */
+template <class __Lane_t>
+inline auto LocateInBlock(const __Lane_t* p, Size_t block, Size_t n, __Lane_t best) -> Size_t
+{
+    for (Size_t i = block; i < n; ++i)
+        if (p[i] == best)
+            return i;
+    return n;
+}
+
+template <class __Lane_t>
+auto FindSse2(const __Lane_t* p, Size_t n, __Lane_t val) -> Size_t
+{
+    using Ops_t     = Sse2<__Lane_t>;
+    const auto key = Ops_t::Set1(val);
+    Size_t     i   = 0;
+    for (const Size_t body = n - n % Ops_t::Lanes; i < body; i += Ops_t::Lanes)
+        if (const unsigned m = Ops_t::EqMask(Ops_t::Load(p + i), key))
+            return i + std::countr_zero(m);
+    return FindTail(p, i, n, val);
+}
+
+template <class __Lane_t>
+auto CountSse2(const __Lane_t* p, Size_t n, __Lane_t val) -> Size_t
+{
+    using Ops_t     = Sse2<__Lane_t>;
+    const auto key = Ops_t::Set1(val);
+    Size_t     c   = 0;
+    Size_t     i   = 0;
+    for (const Size_t body = n - n % Ops_t::Lanes; i < body; i += Ops_t::Lanes)
+        c += std::popcount(Ops_t::EqMask(Ops_t::Load(p + i), key));
+    return c + CountTail(p, i, n, val);
+}
+
+template <bool __IsMax_v, class __Lane_t>
+auto MinMaxSse2(const __Lane_t* p, Size_t n) -> Size_t
+{
+    using Ops_t      = Sse2<__Lane_t>;
+    __Lane_t best    = p[0];
+    Size_t   best_at = 0;
+    for (Size_t b = 0; b < n; b += MinMaxBlock_v)
+    {
+        const Size_t end = n - b < MinMaxBlock_v ? n : b + MinMaxBlock_v;
+        auto         acc = Ops_t::Set1(p[b]);
+        unsigned     nan = 0;
+        Size_t       i   = b;
+        for (const Size_t body = end - (end - b) % Ops_t::Lanes; i < body; i += Ops_t::Lanes)
+        {
+            const auto v = Ops_t::Load(p + i);
+            nan |= Ops_t::NanMask(v);
+            acc = __IsMax_v ? Ops_t::Max(acc, v) : Ops_t::Min(acc, v);
+        }
+        alignas(16) __Lane_t lanes[Ops_t::Lanes];
+        Ops_t::Store(lanes, acc);
+        bool           tail_nan = false;
+        const __Lane_t m        = ReduceLanes<__IsMax_v>(lanes, Ops_t::Lanes, p, i, end, tail_nan);
+        if (nan || tail_nan)
+            return NanFound_v;
+        if (__IsMax_v ? best < m : m < best)
+        {
+            best    = m;
+            best_at = b;
+        }
+    }
+    return LocateInBlock(p, best_at, n, best);
+}
+
+#if defined(RDS_SIMD_AVX2)
+
+template <class __Lane_t>
+RDS_TARGET_AVX2 auto FindAvx2(const __Lane_t* p, Size_t n, __Lane_t val) -> Size_t
+{
+    using Ops_t     = Avx2<__Lane_t>;
+    const auto key = Ops_t::Set1(val);
+    Size_t     i   = 0;
+    for (const Size_t body = n - n % Ops_t::Lanes; i < body; i += Ops_t::Lanes)
+        if (const unsigned m = Ops_t::EqMask(Ops_t::Load(p + i), key))
+            return i + std::countr_zero(m);
+    return FindTail(p, i, n, val);
+}
+
+template <class __Lane_t>
+RDS_TARGET_AVX2 auto CountAvx2(const __Lane_t* p, Size_t n, __Lane_t val) -> Size_t
+{
+    using Ops_t     = Avx2<__Lane_t>;
+    const auto key = Ops_t::Set1(val);
+    Size_t     c   = 0;
+    Size_t     i   = 0;
+    for (const Size_t body = n - n % Ops_t::Lanes; i < body; i += Ops_t::Lanes)
+        c += std::popcount(Ops_t::EqMask(Ops_t::Load(p + i), key));
+    return c + CountTail(p, i, n, val);
+}
+
+template <bool __IsMax_v, class __Lane_t>
+RDS_TARGET_AVX2 auto MinMaxAvx2(const __Lane_t* p, Size_t n) -> Size_t
+{
+    using Ops_t      = Avx2<__Lane_t>;
+    __Lane_t best    = p[0];
+    Size_t   best_at = 0;
+    for (Size_t b = 0; b < n; b += MinMaxBlock_v)
+    {
+        const Size_t end = n - b < MinMaxBlock_v ? n : b + MinMaxBlock_v;
+        auto         acc = Ops_t::Set1(p[b]);
+        unsigned     nan = 0;
+        Size_t       i   = b;
+        for (const Size_t body = end - (end - b) % Ops_t::Lanes; i < body; i += Ops_t::Lanes)
+        {
+            const auto v = Ops_t::Load(p + i);
+            nan |= Ops_t::NanMask(v);
+            acc = __IsMax_v ? Ops_t::Max(acc, v) : Ops_t::Min(acc, v);
+        }
+        alignas(32) __Lane_t lanes[Ops_t::Lanes];
+        Ops_t::Store(lanes, acc);
+        bool           tail_nan = false;
+        const __Lane_t m        = ReduceLanes<__IsMax_v>(lanes, Ops_t::Lanes, p, i, end, tail_nan);
+        if (nan || tail_nan)
+            return NanFound_v;
+        if (__IsMax_v ? best < m : m < best)
+        {
+            best    = m;
+            best_at = b;
+        }
+    }
+    return LocateInBlock(p, best_at, n, best);
+}
+
+#endif // RDS_SIMD_AVX2
+
+} // namespace impl
+
+#endif // RDS_SIMD_X86
+
+/** @brief 실행 중인 CPU가 AVX2를 지원하는지 여부. 처음 호출할 때 한 번만 확인한다. */
+inline auto HasAvx2() -> bool
+{
+#if defined(RDS_SIMD_AVX2)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2;
+#else
+    return false;
+#endif
+}
+
+/** @brief `p[0, n)` 에서 \p val 과 같은 첫 원소의 위치. 없으면 \p n 을 반환한다.
+ *  @details AVX2를 지원하면 AVX2 커널을, 아니면 SSE2 커널을 사용한다. x86-64가 아니면 원소를 하나씩 비교한다.
+ */
+template <class __T_t>
+auto Find(const __T_t* p, Size_t n, const __T_t& val) -> Size_t
+{
+    static_assert(IsEqualityVectorizable_v<__T_t>);
+    using L_t         = Lane_t<__T_t>;
+    const L_t* lanes  = reinterpret_cast<const L_t*>(p);
+    const L_t  key    = std::bit_cast<L_t>(val);
+#if defined(RDS_SIMD_X86)
+#if defined(RDS_SIMD_AVX2)
+    if (HasAvx2())
+        return impl::FindAvx2(lanes, n, key);
+#endif
+    return impl::FindSse2(lanes, n, key);
+#else
+    for (Size_t i = 0; i < n; ++i)
+        if (lanes[i] == key)
+            return i;
+    return n;
+#endif
+}
+
+/** @brief `p[0, n)` 에서 \p val 과 같은 원소의 수 */
+template <class __T_t>
+auto Count(const __T_t* p, Size_t n, const __T_t& val) -> Size_t
+{
+    static_assert(IsEqualityVectorizable_v<__T_t>);
+    using L_t         = Lane_t<__T_t>;
+    const L_t* lanes  = reinterpret_cast<const L_t*>(p);
+    const L_t  key    = std::bit_cast<L_t>(val);
+#if defined(RDS_SIMD_X86)
+#if defined(RDS_SIMD_AVX2)
+    if (HasAvx2())
+        return impl::CountAvx2(lanes, n, key);
+#endif
+    return impl::CountSse2(lanes, n, key);
+#else
+    Size_t c = 0;
+    for (Size_t i = 0; i < n; ++i)
+        c += lanes[i] == key;
+    return c;
+#endif
+}
+
+/** @brief `p[0, n)` 에서 가장 작은(\p __IsMax_v 이면 가장 큰) 첫 원소의 위치
+ *  @details \p n 은 0보다 커야 한다. 범위에 NaN이 있으면 \ref NanFound_v 를 반환하며,
+ *  호출자는 `operator<` 로 하나씩 비교하는 구현으로 다시 계산해야 한다.
+ *  (NaN이 섞인 범위에서의 결과를 비교자 버전과 같게 유지하기 위함이다)
+ */
+template <bool __IsMax_v, class __T_t>
+auto MinMaxIndex(const __T_t* p, Size_t n) -> Size_t
+{
+    static_assert(IsOrderVectorizable_v<__T_t>);
+#if defined(RDS_SIMD_X86)
+#if defined(RDS_SIMD_AVX2)
+    if (HasAvx2())
+        return impl::MinMaxAvx2<__IsMax_v>(p, n);
+#endif
+    return impl::MinMaxSse2<__IsMax_v>(p, n);
+#else
+    Size_t best = 0;
+    for (Size_t i = 1; i < n; ++i)
+    {
+        if (p[i] != p[i])
+            return NanFound_v;
+        if (__IsMax_v ? p[best] < p[i] : p[i] < p[best])
+            best = i;
+    }
+    return p[0] != p[0] ? NanFound_v : best;
+#endif
+}
+
+/** @brief 길이가 \p __N_v 인 짧은 블록에서 가장 작은(\p __IsMax_v 이면 가장 큰) 첫 원소의 위치
+ *  @details 힙에서 자식들 중 하나를 고를 때처럼 짧은 범위를 자주 훑는 용도이다. 호출마다 CPU 기능을
+ *  확인하지 않도록 SSE2 레지스터만 사용하며, \p __N_v 는 레인 수의 배수여야 한다.
+ *  NaN이 있으면 반환하는 위치는 정해지지 않지만 항상 \p __N_v 보다 작다.
+ */
+template <bool __IsMax_v, Size_t __N_v, class __T_t>
+inline auto BlockMinMaxIndex(const __T_t* p) -> Size_t
+{
+    static_assert(IsOrderVectorizable_v<__T_t>);
+#if defined(RDS_SIMD_X86)
+    using Ops_t = impl::Sse2<__T_t>;
+    static_assert(__N_v % Ops_t::Lanes == 0, "block length must be a multiple of the lane count");
+    auto acc = Ops_t::Load(p);
+    for (Size_t i = Ops_t::Lanes; i < __N_v; i += Ops_t::Lanes)
+        acc = __IsMax_v ? Ops_t::Max(acc, Ops_t::Load(p + i)) : Ops_t::Min(acc, Ops_t::Load(p + i));
+    // 모든 레인이 최솟값(최댓값)이 될 때까지 레지스터 안에서 줄인다.
+    acc = __IsMax_v ? Ops_t::Max(acc, Ops_t::SwapHalves(acc)) : Ops_t::Min(acc, Ops_t::SwapHalves(acc));
+    if constexpr (Ops_t::Lanes == 4)
+        acc = __IsMax_v ? Ops_t::Max(acc, Ops_t::SwapPairs(acc)) : Ops_t::Min(acc, Ops_t::SwapPairs(acc));
+    const auto key = acc;
+    for (Size_t i = 0; i < __N_v; i += Ops_t::Lanes)
+        if (const unsigned m = Ops_t::EqMask(Ops_t::Load(p + i), key))
+            return i + std::countr_zero(m);
+    return 0;
+#else
+    Size_t best = 0;
+    for (Size_t i = 1; i < __N_v; ++i)
+        if (__IsMax_v ? p[best] < p[i] : p[i] < p[best])
+            best = i;
+    return best;
+#endif
+}
+
+} // namespace rds::simd
+
+#endif // RDS_SIMD_HPP
@@ -0,0 +1,90 @@
+#ifndef RDS_TALLOCATOR_HPP
+#define RDS_TALLOCATOR_HPP
+
+#include <new>
+#include <utility> // std::forward
+
+#include "Assertion.h"
+#include "RDS_CoreDefs.h"
+
+#include "../thread_cache.h"
+
+namespace rds
+{
+
+/** @brief 스레드별 캐시를 가지는 크기 등급 할당기(\ref thread_cache)를
+ *  사용하는 메모리 할당자
+ *  @tparam __T_t 할당할 메모리의 자료형
+ *  @details
+ *  여러 스레드에서 컨테이너를 사용할 때 전역 힙의 경합을 줄이기 위해 사용한다.
+ *  해제할 때 크기로 크기 등급을 바로 찾으므로, 크기를 받는
+ *  \ref AllocatorTraits::Deallocate 로만 해제할 수 있다.
+ *  스레드 캐시가 소멸한 뒤(정적 컨테이너의 소멸자 등)의 할당과 해제는
+ *  중앙 리스트로 직접 넘어가므로 안전하다.
+ */
+template <class __T_t>
+class Tallocator
+{
+public:
+    using Value_t      = __T_t;
+    using Size_t       = std::size_t;
+    using Difference_t = std::ptrdiff_t;
+
+public:
+    Tallocator()                  = default;
+    Tallocator(const Tallocator&) = default;
+    ~Tallocator()                 = default;
+
+    /// @{ @name Memory Allocation & Deallocation
+public:
+    /** @copydoc AllocatorTraits::Allocate
+     *
+     *  @exception 할당이 실패한 경우 `std::bad_alloc`
+     */
+    auto Allocate(Size_t count) -> Value_t*
+    {
+        return static_cast<Value_t*>(
+            thread_cache::allocate(sizeof(Value_t) * count, alignof(Value_t)));
+    }
+
+    /** @copydoc AllocatorTraits::Deallocate(Allocator_t&, const Value_t*, Size_t)
+     */
+    auto Deallocate(const Value_t* ptr, Size_t count) -> void
+    {
+        if (ptr == nullptr)
+            return;
+
+        thread_cache::deallocate(const_cast<Value_t*>(ptr),
+                                 sizeof(Value_t) * count, alignof(Value_t));
+    }
+
+    /// @} // Memory Allocation & Deallocation
+
+    /// @{ @name Object Construction & Deconstruction
+public:
+    /** @copydoc AllocatorTraits::Construct */
+    template <class... __CtorArgs_t>
+    auto Construct(Value_t* ptr, Size_t count, __CtorArgs_t&&... ctor_args)
+        -> void
+    {
+        for (Size_t i = 0; i < count; ++i)
+        {
+            ::new (ptr + i) Value_t(std::forward<__CtorArgs_t>(ctor_args)...);
+        }
+    }
+
+    /** @copydoc AllocatorTraits::Deconstruct */
+    auto Deconstruct(const Value_t* ptr, Size_t count) -> void
+    {
+        for (Size_t i = 0; i < count; ++i)
+        {
+            (ptr + i)->~Value_t();
+        }
+    }
+
+    /// @} // Object Construction & Deconstruction
+};
+
+} // namespace rds
+
+#endif // RDS_TALLOCATOR_HPP
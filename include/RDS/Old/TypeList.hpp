@@ -69,7 +69,7 @@ using PushFront =
 namespace impl
 {
 template <class __TypeList_t, std::size_t __Index_v>
-class Get: public Get<PopFront<PopFront<__TypeList_t>, __Index_v - 1>>
+class Get: public Get<typename PopFront<__TypeList_t>::Type_t, __Index_v - 1>
 {};
 
 template <class __TypeList_t>
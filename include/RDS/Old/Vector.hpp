@@ -17,12 +17,15 @@ namespace rds
  *  Nallocator)
  */
 template <class __T_t, template <class> class __Alloc_t = Nallocator>
-class Vector
+class Vector: private AllocatorStorage<__Alloc_t<__T_t>>
 {
 public:
     using Allocator_t = __Alloc_t<__T_t>;
     using Size_t      = std::size_t;
 
+private:
+    using AllocatorStorage<Allocator_t>::__Allocator;
+
 public:
     using Value_t      = __T_t;
     using Pointer_t    = __T_t*;
@@ -48,20 +51,33 @@ public:
     /** @brief 기본 소멸자  */
     ~Vector()
     {
-        AllocatorTraits<Allocator_t>::Deconstruct(m_ptr, m_size);
-        AllocatorTraits<Allocator_t>::Deallocate(m_ptr);
+        AllocatorTraits<Allocator_t>::Deconstruct(__Allocator(), m_ptr,
+                                                  m_size);
+        AllocatorTraits<Allocator_t>::Deallocate(__Allocator(), m_ptr,
+                                                 m_capacity);
     }
 
+    /** @brief 할당자를 지정하는 생성자
+     *  @param[in] alloc 원소를 할당할 할당자
+     */
+    explicit Vector(const Allocator_t& alloc)
+        : AllocatorStorage<Allocator_t>(alloc)
+    {}
+
     /** @brief 벡터의 초기 크기와 초기 값을 지정하는 생성자
      * @param[in] size 생성할 벡터의 크기
      * @param[in] init_val 생성할 벡터의 초기값.
+     * @param[in] alloc 원소를 할당할 할당자
      */
-    Vector(Size_t size, const Value_t& init_val = Value_t())
-        : m_size(size)
+    Vector(Size_t size, const Value_t& init_val = Value_t(),
+           const Allocator_t& alloc = Allocator_t())
+        : AllocatorStorage<Allocator_t>(alloc)
+        , m_size(size)
         , m_capacity(size)
     {
-        m_ptr = AllocatorTraits<Allocator_t>::Allocate(size);
-        AllocatorTraits<Allocator_t>::Construct(m_ptr, size, init_val);
+        m_ptr = AllocatorTraits<Allocator_t>::Allocate(__Allocator(), size);
+        AllocatorTraits<Allocator_t>::Construct(__Allocator(), m_ptr, size,
+                                                init_val);
     }
 
     /** @brief 초기화 리스트를 받는 생성자
@@ -71,10 +87,9 @@ public:
         : m_size(ilist.size())
         , m_capacity(ilist.size())
     {
-        m_ptr    = AllocatorTraits<Allocator_t>::Allocate(m_size);
-        auto ptr = m_ptr;
-        for (Size_t i = 0; i < m_size; ++i)
-            ptr[i] = *(ilist.begin() + i);
+        m_ptr = AllocatorTraits<Allocator_t>::Allocate(__Allocator(), m_size);
+        AllocatorTraits<Allocator_t>::ConstructCopy(__Allocator(), m_ptr,
+                                                    ilist.begin(), m_size);
     }
 
     /** @brief 초기화 리스트를 받는 대입 연산자
@@ -98,24 +113,57 @@ public:
     //         m_ptr[i] = *it_first++;
     // }
 
+    /** @brief 벡터의 내용을 `val` 의 복사본 `count` 개로 바꾼다.
+     *  @details 용량이 충분하면 메모리를 재사용한다. trivially copyable 한
+     *  자료형은 `memset`/`memcpy` 로 채운다
+     *  (\ref AllocatorTraits::ConstructFill).
+     */
     auto Assign(Size_t count, const Value_t& val) -> void
     {
-        AllocatorTraits<Allocator_t>::Deconstruct(m_ptr, m_capacity);
-        AllocatorTraits<Allocator_t>::Deallocate(m_ptr);
-
-        AllocatorTraits<Allocator_t>::Allocate(count);
-        AllocatorTraits<Allocator_t>::Construct(m_ptr, count, val);
-
-        m_capacity = count;
-        m_size     = count;
+        AllocatorTraits<Allocator_t>::Deconstruct(__Allocator(), m_ptr,
+                                                  m_size);
+        m_size = 0;
+        __ReallocateIfNeeded(count);
+
+        AllocatorTraits<Allocator_t>::ConstructFill(__Allocator(), m_ptr,
+                                                    count, val);
+        m_size = count;
     }
 
+    /** @brief 벡터의 내용을 초기화 리스트의 원소들로 바꾼다.
+     *  @details 용량이 충분하면 메모리를 재사용한다.
+     */
     auto Assign(const std::initializer_list<Value_t>& ilist) -> void
     {
-        AllocatorTraits<Allocator_t>::Deconstruct(m_ptr, m_capacity);
-        AllocatorTraits<Allocator_t>::Deallocate(m_ptr);
+        AllocatorTraits<Allocator_t>::Deconstruct(__Allocator(), m_ptr,
+                                                  m_size);
+        m_size = 0;
+        __ReallocateIfNeeded(ilist.size());
+
+        AllocatorTraits<Allocator_t>::ConstructCopy(__Allocator(), m_ptr,
+                                                    ilist.begin(),
+                                                    ilist.size());
+        m_size = ilist.size();
     }
 
+private:
+    /** @brief 비어있는 벡터의 용량이 `count` 보다 작으면 메모리를 새로
+     *  할당한다.
+     */
+    auto __ReallocateIfNeeded(Size_t count) -> void
+    {
+        if (count <= m_capacity)
+            return;
+
+        auto* new_ptr =
+            AllocatorTraits<Allocator_t>::Allocate(__Allocator(), count);
+        AllocatorTraits<Allocator_t>::Deallocate(__Allocator(), m_ptr,
+                                                 m_capacity);
+        m_ptr      = new_ptr;
+        m_capacity = count;
+    }
+
+public:
     /// @{  @name Access
 
 public:
@@ -184,6 +232,9 @@ public:
     /** @brief 센티넬 원소에 대한 상수 포인터를 반환한다. */
     auto GetSentinelPointer() const -> const Value_t* { return m_ptr; }
 
+    /** @brief 이 벡터가 사용하는 할당자의 사본을 반환한다. */
+    auto GetAllocator() const -> Allocator_t { return __Allocator(); }
+
     /// @} // Access
 
     /// @{ @name Iterators
@@ -265,13 +316,25 @@ public:
             return;
 
         // 재할당 후 복사
-        auto* new_ptr = AllocatorTraits<Allocator_t>::Allocate(reserve_size);
-        for (Size_t i = 0; i < m_size; ++i)
-            new_ptr[i] = m_ptr[i];
+        auto* new_ptr =
+            AllocatorTraits<Allocator_t>::Allocate(__Allocator(), reserve_size);
+        try
+        {
+            AllocatorTraits<Allocator_t>::ConstructMove(__Allocator(), new_ptr,
+                                                        m_ptr, m_size);
+        }
+        catch (...)
+        {
+            AllocatorTraits<Allocator_t>::Deallocate(__Allocator(), new_ptr,
+                                                     reserve_size);
+            throw;
+        }
 
         // 기존 요소들의 소멸자 호출 및 메모리 해제
-        AllocatorTraits<Allocator_t>::Deconstruct(m_ptr, m_size);
-        AllocatorTraits<Allocator_t>::Deallocate(m_ptr);
+        AllocatorTraits<Allocator_t>::Deconstruct(__Allocator(), m_ptr,
+                                                  m_size);
+        AllocatorTraits<Allocator_t>::Deallocate(__Allocator(), m_ptr,
+                                                 m_capacity);
 
         // 새 메모리로 포인터 변경
         m_ptr = new_ptr;
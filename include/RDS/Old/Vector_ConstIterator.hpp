@@ -13,12 +13,12 @@ namespace rds
 
 /** @brief \ref Vector 컨테이너에 대한 상수 반복자 템플릿 클래스
  *  @tparam __Vector_t 이 상수 반복자가 가리킬 벡터 자료형
- *  @details 임의 접근 반복자이다.
+ *  @details 연속 반복자이다.
  */
 // clang-format off
 template <class __Vector_t>
 class Vector_ConstIterator
-    : public Iterator< tag::RandomAccessIterator
+    : public Iterator< tag::ContiguosIterator_Tag
                      , typename __Vector_t::Value_t
                      , typename __Vector_t::Pointer_t
                      , typename __Vector_t::Reference_t
@@ -29,7 +29,7 @@ public:
 
     /// @{ @name Iterator Traits
 public:
-    using Iterator_t = Iterator< tag::RandomAccessIterator
+    using Iterator_t = Iterator< tag::ContiguosIterator_Tag
                                , typename __Vector_t::Value_t
                                , typename __Vector_t::Pointer_t
                                , typename __Vector_t::Reference_t
@@ -149,6 +149,9 @@ public:
     /// @} // Random Access Iterator Operations
 
     /// @{ @name Data Access
+    /** @brief 두 반복자 사이의 거리. 아래의 `operator-` 에 가려지지 않게 한다. */
+    using Super_t::operator-;
+
     auto operator-(const Difference_t& offset) -> Vector_Iterator
     {
         auto temp = *this;
@@ -0,0 +1,138 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace rds {
+
+/// @brief 투명 대형 페이지(THP)의 크기
+inline constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+
+/// @brief `Align` 바이트 경계에 맞춘 메모리를 할당하는 할당자
+/// @tparam Align 정렬 (2의 거듭제곱, `alignof(T)` 이상)
+/// @tparam HugeThreshold 0이 아니면, 이 크기 이상의 할당은 `mmap` 으로 받고 `MADV_HUGEPAGE` 를 요청한다.
+/// @details
+/// 대형 페이지 영역은 \ref huge_page_size 경계에 맞추고 크기도 그 배수로 올려서 잡으므로,
+/// 커널이 영역 전체를 대형 페이지로 채울 수 있다. 해제 시 `n` 으로 크기를 다시 계산하므로
+/// 반드시 할당한 개수를 그대로 넘겨야 한다. Linux 가 아니면 정렬된 `::operator new` 로 대신한다.
+template <class T, std::size_t Align=64, std::size_t HugeThreshold=0>
+class aligned_allocator {
+	static_assert((Align & (Align - 1)) == 0, "Align must be a power of two");
+	static_assert(Align >= alignof(T), "Align must not be weaker than alignof(T)");
+public:
+	using value_type = T;
+	using pointer = T*;
+	using size_type = std::size_t;
+	using propagate_on_container_move_assignment = std::true_type;
+	using is_always_equal = std::true_type;
+	template <class U>
+	struct rebind {
+		using other = aligned_allocator<U, (Align > alignof(U) ? Align : alignof(U)), HugeThreshold>;
+	};
+
+	static constexpr std::size_t alignment = Align;
+
+	aligned_allocator() = default;
+	template <class U, std::size_t A>
+	aligned_allocator(const aligned_allocator<U, A, HugeThreshold>&) {}
+
+	size_type max_size() const {
+		return size_type(-1) / 2 / sizeof(T);
+	}
+
+	pointer allocate(size_type n) {
+		if (n > max_size()) {
+			throw std::bad_alloc();
+		}
+
+		const std::size_t bytes = n * sizeof(T);
+		if (use_huge_pages(bytes)) {
+			return static_cast<pointer>(map_huge(bytes));
+		}
+		return static_cast<pointer>(::operator new(bytes, std::align_val_t{Align}));
+	}
+
+	void deallocate(pointer p, size_type n) {
+		const std::size_t bytes = n * sizeof(T);
+		if (use_huge_pages(bytes)) {
+			unmap_huge(p, bytes);
+			return;
+		}
+		::operator delete(p, bytes, std::align_val_t{Align});
+	}
+
+	template <class U, class... Args>
+	void construct(U* p, Args&&... args) {
+		::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+	}
+
+	template <class U>
+	void destroy(U* p) {
+		p->~U();
+	}
+private:
+	static constexpr bool use_huge_pages(std::size_t bytes) {
+#if defined(__linux__)
+		return HugeThreshold != 0 && bytes >= HugeThreshold;
+#else
+		return false;
+#endif
+	}
+
+	static constexpr std::size_t huge_round(std::size_t bytes) {
+		return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+	}
+
+#if defined(__linux__)
+	/// @brief 대형 페이지 경계에 맞춘 영역을 잡기 위해 한 페이지를 더 매핑한 뒤 앞뒤를 잘라낸다.
+	static void* map_huge(std::size_t bytes) {
+		const std::size_t len = huge_round(bytes);
+		void* raw = ::mmap(nullptr, len + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (raw == MAP_FAILED) {
+			throw std::bad_alloc();
+		}
+
+		const auto begin = reinterpret_cast<std::uintptr_t>(raw);
+		const auto aligned = (begin + huge_page_size - 1) & ~(huge_page_size - 1);
+		if (aligned != begin) {
+			::munmap(raw, aligned - begin);
+		}
+		if (const std::size_t tail = begin + huge_page_size - aligned) {
+			::munmap(reinterpret_cast<void*>(aligned + len), tail);
+		}
+#if defined(MADV_HUGEPAGE)
+		::madvise(reinterpret_cast<void*>(aligned), len, MADV_HUGEPAGE); // 실패해도 일반 페이지로 동작한다.
+#endif
+		return reinterpret_cast<void*>(aligned);
+	}
+
+	static void unmap_huge(void* p, std::size_t bytes) {
+		::munmap(p, huge_round(bytes));
+	}
+#else
+	static void* map_huge(std::size_t) { return nullptr; }
+	static void unmap_huge(void*, std::size_t) {}
+#endif
+}; // class aligned_allocator
+
+/// @brief 캐시 라인에 맞추고, 대형 페이지 크기 이상의 할당은 대형 페이지로 받는 할당자
+template <class T>
+using huge_page_allocator = aligned_allocator<T, (alignof(T) > 64 ? alignof(T) : 64), huge_page_size>;
+
+template <class T, std::size_t A, class U, std::size_t B, std::size_t H>
+bool operator==(const aligned_allocator<T, A, H>&, const aligned_allocator<U, B, H>&) {
+	return true;
+}
+
+template <class T, std::size_t A, class U, std::size_t B, std::size_t H>
+bool operator!=(const aligned_allocator<T, A, H>&, const aligned_allocator<U, B, H>&) {
+	return false;
+}
+
+} // namespace rds
@@ -2,7 +2,10 @@
 #include <vector>
 #include <utility>
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <new>
+#include <type_traits>
 
 namespace rds {
 
@@ -12,6 +15,12 @@ public:
 	using value_type = T;
 	using pointer = T*;
 	using size_type = std::size_t;
+	using propagate_on_container_move_assignment = std::true_type;
+	using is_always_equal = std::true_type;
+
+	allocator() = default;
+	template <class U>
+	allocator(const allocator<U>&) {}
 
 	size_type max_size() const {
 		return size_type(-1) / sizeof(T);
@@ -25,8 +34,9 @@ public:
 		return static_cast<pointer>(::operator new(n * sizeof(value_type)));
 	}
 
+	/// @brief 크기를 받는 `::operator delete` 로 넘겨서, 전역 할당기가 크기 등급을 다시 찾지 않게 한다.
 	void deallocate(pointer p, size_type n) {
-		::operator delete(p);
+		::operator delete(p, n * sizeof(value_type));
 	}
 
 	template <class U, class... Args>
@@ -51,4 +61,145 @@ bool operator!=(const allocator<T>&, const allocator<U>&) {
 	return false;
 }
 
+/// @brief 모든 바이트를 0으로 채운 표현이 값 초기화한 객체와 같은지 여부
+/// @details 기본값은 멤버 포인터를 제외한 trivial 형식이다. (멤버 포인터의 널 값은 0이 아닐 수 있다)
+/// 멤버 포인터를 멤버로 가지는 trivial 클래스는 특수화로 false 를 지정해야 한다.
+template <class T>
+struct is_zero_initializable: std::bool_constant<std::is_trivial_v<T> && !std::is_member_pointer_v<T>> {};
+
+template <class T>
+inline constexpr bool is_zero_initializable_v = is_zero_initializable<T>::value;
+
+namespace detail {
+/// @brief trivially copyable 한 \p v 로 \p p 부터 \p n 개를 채운다.
+/// @details 모든 바이트가 같은 값이면 `memset` 한 번으로 채운다. 아니면 앞쪽 최대 4 KiB 를 두 배씩 늘려가며
+/// 채운 뒤, L1 캐시에 남아있는 그 구간을 나머지에 반복해서 `memcpy` 한다.
+template <class T>
+void fill_trivial(T* p, std::size_t n, const T& v) {
+	if (n == 0) {
+		return;
+	}
+	const auto* bytes = reinterpret_cast<const unsigned char*>(&v);
+	bool uniform = true;
+	for (std::size_t i = 1; i < sizeof(T); ++i) {
+		uniform = uniform && bytes[i] == bytes[0];
+	}
+	if (uniform) {
+		std::memset(static_cast<void*>(p), bytes[0], sizeof(T) * n);
+		return;
+	}
+	constexpr std::size_t block = 4096 / sizeof(T) > 0 ? 4096 / sizeof(T) : 1;
+	std::memcpy(static_cast<void*>(p), &v, sizeof(T));
+	std::size_t done = 1;
+	for (; done < n && done < block; done *= 2) {
+		const std::size_t len = done < n - done ? done : n - done;
+		std::memcpy(static_cast<void*>(p + done), static_cast<const void*>(p), sizeof(T) * len);
+	}
+	for (const std::size_t step = done; done < n; done += step) {
+		const std::size_t len = step < n - done ? step : n - done;
+		std::memcpy(static_cast<void*>(p + done), static_cast<const void*>(p), sizeof(T) * len);
+	}
+}
+} // namespace detail
+
+/// @{
+/// @brief 초기화되지 않은 메모리에 원소들을 한 번에 생성/소멸시키는 함수들
+/// @details \ref relocate 와 같이, trivial 한 형식은 할당자의 `construct`/`destroy` 를 거치지 않고
+/// `memset`/`memcpy` 로 처리하거나 아무 것도 하지 않는다. 그 외의 형식은 할당자를 통해 하나씩 생성하며,
+/// 생성자가 예외를 던지면 이미 생성한 원소들을 소멸시키고 다시 던진다.
+
+/// @brief \p p 부터 \p n 개의 원소를 소멸시킨다. trivially destructible 한 형식이면 아무 것도 하지 않는다.
+template <class A, class T>
+void destroy_n(A& a, T* p, std::size_t n) {
+	if constexpr (!std::is_trivially_destructible_v<T>) {
+		for (std::size_t i = 0; i < n; ++i) {
+			std::allocator_traits<A>::destroy(a, p + i);
+		}
+	}
+}
+
+/// @brief \p p 부터 \p n 개의 원소를 값 초기화한다.
+template <class A, class T>
+void construct_n(A& a, T* p, std::size_t n) {
+	using traits = std::allocator_traits<A>;
+	if constexpr (is_zero_initializable_v<T>) {
+		if (n != 0) {
+			std::memset(static_cast<void*>(p), 0, sizeof(T) * n);
+		}
+	} else {
+		std::size_t i = 0;
+		try {
+			for (; i < n; ++i) {
+				traits::construct(a, p + i);
+			}
+		} catch (...) {
+			destroy_n(a, p, i);
+			throw;
+		}
+	}
+}
+
+/// @brief \p p 부터 \p n 개의 원소를 \p v 의 복사본으로 생성한다.
+template <class A, class T>
+void construct_fill_n(A& a, T* p, std::size_t n, const T& v) {
+	using traits = std::allocator_traits<A>;
+	if constexpr (std::is_trivially_copyable_v<T>) {
+		detail::fill_trivial(p, n, v);
+	} else {
+		std::size_t i = 0;
+		try {
+			for (; i < n; ++i) {
+				traits::construct(a, p + i, v);
+			}
+		} catch (...) {
+			destroy_n(a, p, i);
+			throw;
+		}
+	}
+}
+
+/// @brief \p src 의 \p n 개의 원소를 \p dst 에 복사해서 생성한다. 두 구간은 겹치지 않아야 한다.
+template <class A, class T>
+void construct_copy_n(A& a, const T* src, std::size_t n, T* dst) {
+	using traits = std::allocator_traits<A>;
+	if constexpr (std::is_trivially_copyable_v<T>) {
+		if (n != 0) {
+			std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T) * n);
+		}
+	} else {
+		std::size_t i = 0;
+		try {
+			for (; i < n; ++i) {
+				traits::construct(a, dst + i, src[i]);
+			}
+		} catch (...) {
+			destroy_n(a, dst, i);
+			throw;
+		}
+	}
+}
+
+/// @brief \p src 의 \p n 개의 원소를 \p dst 로 이동해서 생성한다. 원본은 소멸시키지 않는다.
+template <class A, class T>
+void construct_move_n(A& a, T* src, std::size_t n, T* dst) {
+	using traits = std::allocator_traits<A>;
+	if constexpr (std::is_trivially_copyable_v<T>) {
+		if (n != 0) {
+			std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T) * n);
+		}
+	} else {
+		std::size_t i = 0;
+		try {
+			for (; i < n; ++i) {
+				traits::construct(a, dst + i, std::move(src[i]));
+			}
+		} catch (...) {
+			destroy_n(a, dst, i);
+			throw;
+		}
+	}
+}
+
+/// @}
+
 } // namespace rds
\ No newline at end of file
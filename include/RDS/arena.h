@@ -0,0 +1,167 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rds {
+
+/// @brief 단조 증가(bump) 방식의 메모리 아레나
+/// @details 상위 할당자(`::operator new`)에서 큰 청크를 받아와 포인터를 앞으로 밀면서 잘라준다.
+/// 개별 해제는 하지 않으며, \ref release 또는 소멸 시 모든 청크를 한 번에 반환한다.
+/// 청크가 부족하면 이전 청크의 2배 크기로 새 청크를 받아온다.
+/// @note 스레드 안전하지 않다.
+class arena {
+public:
+	static constexpr std::size_t default_chunk_size = 4096;
+public:
+	explicit arena(std::size_t chunk_size=default_chunk_size): chunk_size_(chunk_size), next_chunk_size_(chunk_size) {}
+	/// @brief 사용자 버퍼를 첫 청크로 사용하는 생성자. 버퍼가 모자라면 상위 할당자로 넘어간다.
+	arena(void* buf, std::size_t size, std::size_t chunk_size=default_chunk_size):
+		initial_(static_cast<std::byte*>(buf)), initial_end_(initial_ + size),
+		cur_(initial_), end_(initial_end_), chunk_size_(chunk_size), next_chunk_size_(chunk_size) {}
+	arena(const arena&) = delete;
+	arena& operator=(const arena&) = delete;
+	~arena() {
+		release();
+	}
+public:
+	/// @brief \p bytes 크기, \p align 정렬의 메모리를 잘라서 반환
+	void* allocate(std::size_t bytes, std::size_t align=alignof(std::max_align_t)) {
+		// 정렬한 위치가 청크를 넘을 수 있으므로, 포인터를 만들기 전에 남은 크기와 비교한다.
+		std::size_t pad = padding(cur_, align);
+		const auto left = static_cast<std::size_t>(end_ - cur_);
+		if (cur_ == nullptr || left < pad || left - pad < bytes) {
+			grow(bytes, align);
+			pad = padding(cur_, align);
+		}
+		std::byte* p = cur_ + pad;
+		cur_ = p + bytes;
+		allocated_ += bytes;
+		return p;
+	}
+	/// @brief 아무 것도 하지 않는다. 메모리는 \ref release 에서 한 번에 반환된다.
+	void deallocate(void*, std::size_t, std::size_t=alignof(std::max_align_t)) {}
+	/// @brief 상위 할당자에서 받아온 모든 청크를 반환한다. O(청크 수)
+	/// @details 사용자 버퍼로 생성했다면 다시 그 버퍼부터 사용한다.
+	/// @warning 이 아레나에서 할당된 모든 메모리가 무효화된다. 소멸자는 호출되지 않는다.
+	void release() {
+		while (head_) {
+			chunk* next = head_->next;
+			::operator delete(static_cast<void*>(head_), head_->size);
+			head_ = next;
+		}
+		cur_ = initial_;
+		end_ = initial_end_;
+		next_chunk_size_ = chunk_size_;
+		allocated_ = 0;
+	}
+public:
+	/// @brief 지금까지 잘라준 바이트 수 (정렬을 위한 패딩 제외)
+	std::size_t allocated() const {
+		return allocated_;
+	}
+	/// @brief 상위 할당자에서 받아온 청크 수
+	std::size_t chunk_count() const {
+		std::size_t n = 0;
+		for (chunk* c = head_; c; c = c->next)
+			++n;
+		return n;
+	}
+private:
+	struct chunk {
+		chunk* next;
+		std::size_t size; ///< 헤더를 포함해 `::operator new` 로 받은 바이트 수. 크기를 알려주며 해제한다.
+	};
+	/// @brief \p p 를 \p align 경계에 맞추기 위해 건너뛰어야 하는 바이트 수
+	static std::size_t padding(const std::byte* p, std::size_t align) {
+		const auto v = reinterpret_cast<std::uintptr_t>(p);
+		return (align - v % align) % align;
+	}
+	void grow(std::size_t bytes, std::size_t align) {
+		std::size_t size = next_chunk_size_;
+		const std::size_t need = sizeof(chunk) + bytes + align;
+		if (size < need) {
+			size = need;
+		}
+		auto* c = static_cast<chunk*>(::operator new(size));
+		c->next = head_;
+		c->size = size;
+		head_ = c;
+		cur_ = reinterpret_cast<std::byte*>(c) + sizeof(chunk);
+		end_ = reinterpret_cast<std::byte*>(c) + size;
+		next_chunk_size_ *= 2;
+	}
+
+private:
+	std::byte* initial_ = nullptr;
+	std::byte* initial_end_ = nullptr;
+	std::byte* cur_ = nullptr;
+	std::byte* end_ = nullptr;
+	chunk* head_ = nullptr;
+	std::size_t chunk_size_;
+	std::size_t next_chunk_size_;
+	std::size_t allocated_ = 0;
+}; // class arena
+
+/// @brief \ref arena 에서 메모리를 받아오는 할당자
+/// @details \ref allocator 와 같은 `allocate`/`deallocate`/`construct`/`destroy` 를 제공하며,
+/// 컨테이너의 할당자 자리에 넣어 사용한다. `deallocate` 는 아무 것도 하지 않으므로 컨테이너를
+/// 소멸시킨 뒤 \ref arena::release 로 한 번에 정리한다.
+/// @warning 아레나는 이 할당자와 이 할당자를 사용하는 컨테이너보다 오래 살아야 한다.
+template <class T>
+class arena_allocator {
+public:
+	using value_type = T;
+	using pointer = T*;
+	using size_type = std::size_t;
+public:
+	arena_allocator(arena& a): arena_(&a) {}
+	template <class U>
+	arena_allocator(const arena_allocator<U>& o): arena_(o.resource()) {}
+
+	size_type max_size() const {
+		return size_type(-1) / sizeof(T);
+	}
+
+	pointer allocate(size_type n) {
+		if (n > max_size()) {
+			throw std::bad_alloc();
+		}
+
+		return static_cast<pointer>(arena_->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(pointer p, size_type n) {
+		arena_->deallocate(p, n * sizeof(T), alignof(T));
+	}
+
+	template <class U, class... Args>
+	void construct(U* p, Args&&... args) {
+		::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+	}
+
+	template <class U>
+	void destroy(U* p) {
+		p->~U();
+	}
+
+	arena* resource() const {
+		return arena_;
+	}
+private:
+	arena* arena_;
+}; // class arena_allocator
+
+template <class T, class U>
+bool operator==(const arena_allocator<T>& l, const arena_allocator<U>& r) {
+	return l.resource() == r.resource();
+}
+
+template <class T, class U>
+bool operator!=(const arena_allocator<T>& l, const arena_allocator<U>& r) {
+	return !(l == r);
+}
+
+} // namespace rds
@@ -11,6 +11,7 @@ template <class T, std::size_t N>
 class array_it {
 public:
 	using iterator_category = std::random_access_iterator_tag;
+	using iterator_concept = std::contiguous_iterator_tag;
 	using value_type = T;
 	using difference_type = std::ptrdiff_t;
 	using pointer = value_type*;
@@ -103,6 +104,7 @@ public:
 	using array_it<T, N>::off_;
 public:
 	using iterator_category = std::random_access_iterator_tag;
+	using iterator_concept = std::random_access_iterator_tag;
 	using value_type = T;
 	using difference_type = std::ptrdiff_t;
 	using pointer = value_type*;
@@ -0,0 +1,345 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "allocator.h"
+#include "vector.h"
+
+namespace rds {
+
+namespace detail {
+/// @brief \p n 개의 64비트 워드에서 켜진 비트의 수
+/// @details x86-64 에서는 `popcnt` 명령을 지원하는지 한 번 확인해서, 지원하면 그 명령으로 컴파일한 함수를 사용한다.
+/// (`-mpopcnt` 없이 컴파일해도 `std::popcount` 가 소프트웨어 구현으로 떨어지지 않게 한다)
+inline std::size_t popcount_words_generic(const std::uint64_t* p, std::size_t n) {
+	std::size_t c = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		c += std::popcount(p[i]);
+	}
+	return c;
+}
+
+/// @brief \p w 에서 \p k 번째(0부터)로 켜진 비트의 위치. \p k 는 `popcount(w)` 보다 작아야 한다.
+inline unsigned select_in_word_generic(std::uint64_t w, unsigned k) {
+	unsigned shift = 0;
+	// 바이트 단위로 건너뛴 뒤, 남은 비트를 하나씩 지운다.
+	for (unsigned c = std::popcount(w & 0xff); k >= c; c = std::popcount(w & 0xff)) {
+		k -= c;
+		w >>= 8;
+		shift += 8;
+	}
+	for (; k != 0; --k) {
+		w &= w - 1;
+	}
+	return shift + std::countr_zero(w);
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+[[gnu::target("popcnt")]] inline std::size_t popcount_words_hw(const std::uint64_t* p, std::size_t n) {
+	std::size_t c = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		c += __builtin_popcountll(p[i]);
+	}
+	return c;
+}
+
+[[gnu::target("popcnt")]] inline unsigned select_in_word_hw(std::uint64_t w, unsigned k) {
+	unsigned shift = 0;
+	for (unsigned c = __builtin_popcountll(w & 0xff); k >= c; c = __builtin_popcountll(w & 0xff)) {
+		k -= c;
+		w >>= 8;
+		shift += 8;
+	}
+	for (; k != 0; --k) {
+		w &= w - 1;
+	}
+	return shift + std::countr_zero(w);
+}
+
+inline bool has_popcnt() {
+	static const bool hw = __builtin_cpu_supports("popcnt");
+	return hw;
+}
+
+inline std::size_t popcount_words(const std::uint64_t* p, std::size_t n) {
+	return has_popcnt() ? popcount_words_hw(p, n) : popcount_words_generic(p, n);
+}
+
+inline unsigned select_in_word(std::uint64_t w, unsigned k) {
+	return has_popcnt() ? select_in_word_hw(w, k) : select_in_word_generic(w, k);
+}
+#else
+inline std::size_t popcount_words(const std::uint64_t* p, std::size_t n) {
+	return popcount_words_generic(p, n);
+}
+
+inline unsigned select_in_word(std::uint64_t w, unsigned k) {
+	return select_in_word_generic(w, k);
+}
+#endif
+
+/// @brief 워드 하나에서 켜진 비트의 수. \ref popcount_words 와 같은 구현을 사용한다.
+inline std::size_t popcount_word(std::uint64_t w) {
+	return popcount_words(&w, 1);
+}
+} // namespace detail
+
+/// @brief 비트 하나에 원소 하나를 저장하는 불리언 동적 배열 클래스
+/// @tparam alloc 워드(`std::uint64_t`)와 보조 색인의 할당에 사용할 할당자
+/// @details 원소는 64비트 워드에 채워 저장하며, 비트 연산과 \ref count 는 워드 단위로 처리한다.
+/// \ref build_index 로 만드는 보조 색인을 이용하면 \ref rank 는 O(1), \ref select 는 표본 사이의 이진 탐색으로 처리한다.
+/// - 512비트 블록마다 상위 블록 시작부터의 누적 개수(16비트): 3.125%
+/// - 65536비트 상위 블록마다 누적 개수(64비트): 0.1%
+/// - 켜진 비트 8192개마다 그 비트가 있는 블록 번호(64비트): 최대 0.8%
+/// @warning 원소를 바꾸는 연산은 색인을 무효화한다. \ref rank, \ref select 를 호출하기 전에 \ref build_index 를 다시 호출해야 한다.
+template <class alloc=allocator<std::uint64_t>>
+class bit_vector {
+	using word = std::uint64_t;
+	using traits = std::allocator_traits<alloc>;
+	using word_alloc = typename traits::template rebind_alloc<word>;
+	using block_alloc = typename traits::template rebind_alloc<std::uint16_t>;
+
+	static constexpr std::size_t word_bits = 64;
+	static constexpr std::size_t block_words = 8;
+	static constexpr std::size_t block_bits = word_bits * block_words;
+	static constexpr std::size_t superblock_blocks = 128;
+	static constexpr std::size_t superblock_bits = block_bits * superblock_blocks;
+	static constexpr std::size_t select_sample = 8192;
+public:
+	using allocator_type = alloc;
+public:
+	bit_vector() = default;
+	explicit bit_vector(const alloc& a): words_(word_alloc(a)), superblocks_(word_alloc(a)), blocks_(block_alloc(a)), samples_(word_alloc(a)) {}
+	explicit bit_vector(std::size_t size, bool val=false, const alloc& a=alloc()): bit_vector(a) {
+		resize(size, val);
+	}
+public:
+	alloc get_allocator() const {
+		return alloc(words_.get_allocator());
+	}
+	void swap(bit_vector& o) noexcept {
+		words_.swap(o.words_);
+		superblocks_.swap(o.superblocks_);
+		blocks_.swap(o.blocks_);
+		samples_.swap(o.samples_);
+		std::swap(size_, o.size_);
+		std::swap(ones_, o.ones_);
+	}
+public:
+	std::size_t size() const {
+		return size_;
+	}
+	bool empty() const {
+		return size_ == 0;
+	}
+	void reserve(std::size_t bits) {
+		words_.reserve(word_count(bits));
+	}
+	/// @brief 크기를 \p n 으로 바꾼다. 늘어난 원소는 \p val 이 된다.
+	void resize(std::size_t n, bool val=false) {
+		const std::size_t old = size_;
+		reserve(n);
+		while (words_.size() < word_count(n)) {
+			words_.push_back(0);
+		}
+		if (n > old && val) {
+			for (std::size_t i = old; i < n && i % word_bits != 0; ++i) {
+				words_[i / word_bits] |= word{1} << (i % word_bits);
+			}
+			for (std::size_t w = word_count(old); w < word_count(n); ++w) {
+				words_[w] = ~word{0};
+			}
+		}
+		while (words_.size() > word_count(n)) {
+			words_.pop_back();
+		}
+		size_ = n;
+		clear_padding();
+	}
+	void clear() {
+		words_.clear();
+		size_ = 0;
+	}
+public: // 접근
+	bool operator[](std::size_t i) const {
+		return (words_[i / word_bits] >> (i % word_bits)) & 1;
+	}
+	bool test(std::size_t i) const {
+		return (*this)[i];
+	}
+	/// @brief 워드 배열. 마지막 워드에서 \ref size 를 넘는 비트는 항상 0이다.
+	const word* data() const {
+		return words_.data();
+	}
+	std::size_t word_count() const {
+		return words_.size();
+	}
+public: // 수정
+	void push_back(bool v) {
+		if (size_ % word_bits == 0) {
+			words_.push_back(0);
+		}
+		words_.back() |= word{v} << (size_ % word_bits);
+		++size_;
+	}
+	void pop_back() {
+		--size_;
+		if (size_ % word_bits == 0) {
+			words_.pop_back();
+		} else {
+			clear_padding();
+		}
+	}
+	void set(std::size_t i, bool v=true) {
+		const word m = word{1} << (i % word_bits);
+		words_[i / word_bits] = v ? words_[i / word_bits] | m : words_[i / word_bits] & ~m;
+	}
+	void reset(std::size_t i) {
+		set(i, false);
+	}
+	void flip(std::size_t i) {
+		words_[i / word_bits] ^= word{1} << (i % word_bits);
+	}
+public: // 비트 연산
+	/// @brief 모든 원소를 뒤집는다.
+	void flip() {
+		for (std::size_t w = 0; w < words_.size(); ++w) {
+			words_[w] = ~words_[w];
+		}
+		clear_padding();
+	}
+	/// @{
+	/// @brief 워드 단위로 연산한다. 두 비트 벡터의 크기는 같아야 한다.
+	bit_vector& operator&=(const bit_vector& o) {
+		for (std::size_t w = 0; w < words_.size(); ++w) {
+			words_[w] &= o.words_[w];
+		}
+		return *this;
+	}
+	bit_vector& operator|=(const bit_vector& o) {
+		for (std::size_t w = 0; w < words_.size(); ++w) {
+			words_[w] |= o.words_[w];
+		}
+		return *this;
+	}
+	bit_vector& operator^=(const bit_vector& o) {
+		for (std::size_t w = 0; w < words_.size(); ++w) {
+			words_[w] ^= o.words_[w];
+		}
+		return *this;
+	}
+	/// @}
+	bool operator==(const bit_vector& o) const {
+		if (size_ != o.size_) {
+			return false;
+		}
+		for (std::size_t w = 0; w < words_.size(); ++w) {
+			if (words_[w] != o.words_[w]) {
+				return false;
+			}
+		}
+		return true;
+	}
+public: // 순위/선택
+	/// @brief 켜진 비트의 수
+	std::size_t count() const {
+		return detail::popcount_words(words_.data(), words_.size());
+	}
+	/// @brief \ref rank, \ref select 에 사용할 보조 색인을 만든다. O(n)
+	void build_index() {
+		const std::size_t nblocks = (words_.size() + block_words - 1) / block_words;
+		superblocks_.clear();
+		blocks_.clear();
+		samples_.clear();
+		superblocks_.reserve(nblocks / superblock_blocks + 1);
+		blocks_.reserve(nblocks);
+
+		std::size_t total = 0;
+		std::size_t base = 0;
+		for (std::size_t b = 0; b < nblocks; ++b) {
+			if (b % superblock_blocks == 0) {
+				superblocks_.push_back(total);
+				base = total;
+			}
+			blocks_.push_back(static_cast<std::uint16_t>(total - base));
+			const std::size_t first = b * block_words;
+			const std::size_t n = words_.size() - first < block_words ? words_.size() - first : block_words;
+			const std::size_t c = detail::popcount_words(words_.data() + first, n);
+			// 이 블록에서 시작하는 표본들을 기록한다.
+			for (std::size_t k = (total + select_sample - 1) / select_sample * select_sample; k < total + c; k += select_sample) {
+				samples_.push_back(b);
+			}
+			total += c;
+		}
+		ones_ = total;
+	}
+	/// @brief [0, \p i) 에서 켜진 비트의 수. \p i 는 \ref size 이하여야 한다.
+	std::size_t rank(std::size_t i) const {
+		const std::size_t b = i / block_bits;
+		if (b == blocks_.size()) {
+			return ones_;
+		}
+		std::size_t r = superblocks_[b / superblock_blocks] + blocks_[b];
+		const std::size_t last = i / word_bits;
+		r += detail::popcount_words(words_.data() + b * block_words, last - b * block_words);
+		if (i % word_bits != 0) {
+			r += detail::popcount_word(words_[last] & ((word{1} << (i % word_bits)) - 1));
+		}
+		return r;
+	}
+	/// @brief [0, \p i) 에서 꺼진 비트의 수
+	std::size_t rank0(std::size_t i) const {
+		return i - rank(i);
+	}
+	/// @brief \p k 번째(0부터)로 켜진 비트의 위치. \p k 는 켜진 비트의 수보다 작아야 한다.
+	std::size_t select(std::size_t k) const {
+		// 표본 사이에서 누적 개수가 k 이하인 마지막 블록을 찾는다.
+		std::size_t lo = samples_[k / select_sample];
+		std::size_t hi = k / select_sample + 1 < samples_.size() ? samples_[k / select_sample + 1] + 1 : blocks_.size();
+		while (hi - lo > 1) {
+			const std::size_t mid = lo + (hi - lo) / 2;
+			if (block_rank(mid) <= k) {
+				lo = mid;
+			} else {
+				hi = mid;
+			}
+		}
+		k -= block_rank(lo);
+		std::size_t w = lo * block_words;
+		for (std::size_t c = detail::popcount_word(words_[w]); k >= c; c = detail::popcount_word(words_[w])) {
+			k -= c;
+			++w;
+		}
+		return w * word_bits + detail::select_in_word(words_[w], static_cast<unsigned>(k));
+	}
+	/// @brief 데이터와 보조 색인이 차지하는 바이트 수
+	std::size_t memory_usage() const {
+		return words_.capacity() * sizeof(word) + superblocks_.capacity() * sizeof(word) +
+			blocks_.capacity() * sizeof(std::uint16_t) + samples_.capacity() * sizeof(word);
+	}
+private:
+	static constexpr std::size_t word_count(std::size_t bits) {
+		return (bits + word_bits - 1) / word_bits;
+	}
+	std::size_t block_rank(std::size_t b) const {
+		return superblocks_[b / superblock_blocks] + blocks_[b];
+	}
+	/// @brief 마지막 워드에서 \ref size 를 넘는 비트를 지운다.
+	void clear_padding() {
+		if (size_ % word_bits != 0) {
+			words_.back() &= (word{1} << (size_ % word_bits)) - 1;
+		}
+	}
+
+private:
+	vector<word, word_alloc> words_;
+	vector<word, word_alloc> superblocks_;
+	vector<std::uint16_t, block_alloc> blocks_;
+	vector<word, word_alloc> samples_;
+	std::size_t size_ = 0;
+	std::size_t ones_ = 0;
+}; // class bit_vector
+
+} // namespace rds
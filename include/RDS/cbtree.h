@@ -1,4 +1,5 @@
 #include <vector>
+#include <memory>
 #include <cstddef>
 #include <cmath>
 #include <cstdio>
@@ -7,7 +8,8 @@ namespace rds {
 
 /// @brief Complete Binary Template Class
 /// @details Implemented with array(vector)
-template <class T>
+/// @tparam Alloc 노드 배열에 사용할 할당자 (예: \ref polymorphic_allocator)
+template <class T, class Alloc=std::allocator<T>>
 class cbtree {
 private: // Utilities
 	using size_t = std::size_t;
@@ -34,21 +36,11 @@ private: // Utilities
 		return static_cast<size_t>(std::pow(2, lv)) + get_full_size(lv - 1);
 	}
 public: // ctors
-	cbtree(std::vector<T> const& nodes): nodes_(nodes) {}
-	cbtree(size_t size, bool size_is_lv=false) {
-		if (!size_is_lv) {
-			nodes_ = std::vector<T>(size);
-		} else {
-			nodes_ = std::vector<T>(get_full_size(size));
-		}
-	}
-	cbtree(size_t size, T const& v, bool size_is_lv=false) {
-		if (!size_is_lv) {
-			nodes_ = std::vector<T>(size, v);
-		} else {
-			nodes_ = std::vector<T>(get_full_size(size), v);
-		}
-	}
+	cbtree(std::vector<T, Alloc> const& nodes): nodes_(nodes) {}
+	cbtree(size_t size, bool size_is_lv=false, Alloc const& alloc=Alloc()):
+		nodes_(size_is_lv ? get_full_size(size) : size, alloc) {}
+	cbtree(size_t size, T const& v, bool size_is_lv=false, Alloc const& alloc=Alloc()):
+		nodes_(size_is_lv ? get_full_size(size) : size, v, alloc) {}
 public: // sizes
 	/// @brief 존재하는 노드의 총 갯수를 반환
 	size_t size() const {
@@ -68,28 +60,28 @@ public: // member access
 		return nodes_[i];
 	}
 	T& at(size_t i) {
-		return const_cast<T&>(static_cast<cbtree<T> const&>(*this).at(i));
+		return const_cast<T&>(static_cast<cbtree const&>(*this).at(i));
 	}
 	/// @brief \p lvi 번 레벨의 \p io 번째 노드 값의 참조를 반환
 	T const& at_lv(size_t lvi, size_t io) const {
 		return nodes_[i_by_lv(lv, io)];
 	}
 	T& at_lv(size_t lvi, size_t io) {
-		return const_cast<T&>(static_cast<cbtree<T> const&>(*this).at_lv(lvi, io));
+		return const_cast<T&>(static_cast<cbtree const&>(*this).at_lv(lvi, io));
 	}
 	/// @brief 루트 노드 값의 참조를 반환
 	T const& root() const {
 		return nodes_.front();
 	}
 	T& root() {
-		return const_cast<T&>(static_cast<cbtree<T> const&>(*this).root());
+		return const_cast<T&>(static_cast<cbtree const&>(*this).root());
 	}
 	/// @brief 최하단 레벨의 최우측 노드 값의 참조를 반환
 	T const& back() const {
 		return nodes_.back();
 	}
 	T& back() {
-		return const_cast<T&>(static_cast<cbtree<T> const&>(*this).back());
+		return const_cast<T&>(static_cast<cbtree const&>(*this).back());
 	}
 public: // modifiers
 	void push_back(T const& v) {
@@ -98,15 +90,15 @@ public: // modifiers
 	void pop_back() {
 		nodes_.pop_back();
 	}
-	template <class U>
-	friend void println(cbtree<U> const&);
+	template <class U, class A>
+	friend void println(cbtree<U, A> const&);
 
 private:
-	std::vector<T> nodes_;
+	std::vector<T, Alloc> nodes_;
 };
 
-template <class U>
-void println(cbtree<U> const& t) { /* no impl */ }
+template <class U, class A>
+void println(cbtree<U, A> const& t) { /* no impl */ }
 
 #ifdef _MSC_VER
 #include <format> // gcc 에는 구현 안 되어있음 =.=
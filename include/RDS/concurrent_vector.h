@@ -0,0 +1,186 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "allocator.h"
+
+namespace rds {
+
+/// @brief 여러 스레드가 동시에 추가할 수 있는 추가 전용 동적 배열 템플릿 클래스
+/// @tparam FirstSegment 첫 세그먼트의 원소 수 (2의 거듭제곱, 64 이상)
+/// @tparam alloc 세그먼트의 할당에 사용할 할당자. 여러 스레드에서 동시에 호출되므로 스레드 안전해야 한다.
+/// @details
+/// 원소는 크기가 `FirstSegment`, `2 * FirstSegment`, `4 * FirstSegment`, ... 인 세그먼트에 저장되며,
+/// k 번 세그먼트까지의 용량은 `FirstSegment << k` 이다. 세그먼트 목록은 고정 크기 배열이므로 세그먼트도
+/// 원소도 옮겨지지 않는다.
+///
+/// \ref push_back 은 잠금 없이 동작한다. 원자적 `fetch_add` 로 위치를 예약하고, 세그먼트가 아직 없으면
+/// 할당해서 CAS 로 등록한 뒤(경쟁에서 진 스레드는 자기 세그먼트를 반환한다) 그 자리에 원소를 생성한다.
+/// 생성이 끝나면 세그먼트마다 있는 비트맵에 release 로 표시하므로, 다른 스레드는 \ref published 가
+/// true 인 원소를 동기화 없이 읽을 수 있다.
+/// @warning 원소를 지우는 연산은 없다. 복사, 이동, 소멸은 다른 스레드가 사용하지 않을 때만 할 수 있다.
+template <class T, std::size_t FirstSegment=64, class alloc=allocator<T>>
+class concurrent_vector {
+	static_assert(FirstSegment >= 64 && (FirstSegment & (FirstSegment - 1)) == 0, "FirstSegment must be a power of two and at least 64");
+	static constexpr std::size_t first_shift = std::countr_zero(FirstSegment);
+	static constexpr std::size_t max_segments = std::numeric_limits<std::size_t>::digits - first_shift;
+
+	using word = std::atomic<std::uint64_t>;
+	using traits = std::allocator_traits<alloc>;
+	using word_alloc = typename traits::template rebind_alloc<word>;
+	using word_traits = std::allocator_traits<word_alloc>;
+public:
+	using allocator_type = alloc;
+public:
+	concurrent_vector() = default;
+	explicit concurrent_vector(const alloc& a): alloc_(a) {}
+	concurrent_vector(const concurrent_vector&) = delete;
+	concurrent_vector& operator=(const concurrent_vector&) = delete;
+	~concurrent_vector() {
+		const std::size_t n = size_.load(std::memory_order_acquire);
+		for (std::size_t s = 0; s < max_segments; ++s) {
+			T* data = data_[s].load(std::memory_order_relaxed);
+			word* ready = ready_[s].load(std::memory_order_relaxed);
+			const std::size_t len = segment_size(s);
+			const std::size_t base = segment_base(s);
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				if (data && ready) {
+					for (std::size_t i = 0; i < len && base + i < n; ++i) {
+						// 생성 중 예외가 발생한 자리는 표시되지 않았으므로 소멸시키지 않는다.
+						if (ready[i / 64].load(std::memory_order_relaxed) & (std::uint64_t{1} << (i % 64))) {
+							traits::destroy(alloc_, data + i);
+						}
+					}
+				}
+			}
+			if (data) {
+				traits::deallocate(alloc_, data, len);
+			}
+			if (ready) {
+				word_alloc wa(alloc_);
+				destroy_n(wa, ready, len / 64);
+				word_traits::deallocate(wa, ready, len / 64);
+			}
+		}
+	}
+public:
+	alloc get_allocator() const {
+		return alloc_;
+	}
+	/// @brief 예약된 원소 수. 아직 생성 중인 원소가 포함될 수 있다.
+	std::size_t size() const {
+		return size_.load(std::memory_order_acquire);
+	}
+	bool empty() const {
+		return size() == 0;
+	}
+	/// @brief \p n 개를 담을 수 있도록 세그먼트를 미리 할당한다. 다른 스레드의 \ref push_back 과 함께 호출할 수 있다.
+	void reserve(std::size_t n) {
+		for (std::size_t s = 0; n != 0 && segment_base(s) < n; ++s) {
+			ensure_segment(s);
+		}
+	}
+	/// @brief \p i 번 원소의 생성이 끝나서 읽을 수 있는지 여부
+	bool published(std::size_t i) const {
+		const std::size_t s = segment_of(i);
+		const word* ready = ready_[s].load(std::memory_order_acquire);
+		if (ready == nullptr) {
+			return false;
+		}
+		const std::size_t off = i - segment_base(s);
+		return ready[off / 64].load(std::memory_order_acquire) & (std::uint64_t{1} << (off % 64));
+	}
+public: // 접근
+	/// @warning \ref published 가 true 인 원소만 접근할 수 있다.
+	const T& operator[](std::size_t i) const {
+		const std::size_t s = segment_of(i);
+		return data_[s].load(std::memory_order_acquire)[i - segment_base(s)];
+	}
+	T& operator[](std::size_t i) {
+		return const_cast<T&>(static_cast<const concurrent_vector&>(*this)[i]);
+	}
+	/// @brief 지금까지 예약된 원소 중 \ref published 인 원소마다 \p f(i, e) 를 호출한다.
+	template <class F>
+	void for_each_published(F&& f) const {
+		const std::size_t n = size();
+		for (std::size_t i = 0; i < n; ++i) {
+			if (published(i)) {
+				f(i, (*this)[i]);
+			}
+		}
+	}
+public: // 수정
+	std::size_t push_back(const T& v) {
+		return emplace_back(v);
+	}
+	std::size_t push_back(T&& v) {
+		return emplace_back(std::move(v));
+	}
+	/// @brief 맨 뒤에 원소를 생성하고 그 위치를 반환한다. 여러 스레드에서 동시에 호출할 수 있다.
+	template <class... Args>
+	std::size_t emplace_back(Args&&... args) {
+		const std::size_t i = size_.fetch_add(1, std::memory_order_relaxed);
+		const std::size_t s = segment_of(i);
+		const std::size_t off = i - segment_base(s);
+		auto [data, ready] = ensure_segment(s);
+
+		traits::construct(alloc_, data + off, std::forward<Args>(args)...);
+		ready[off / 64].fetch_or(std::uint64_t{1} << (off % 64), std::memory_order_release);
+		return i;
+	}
+private:
+	static constexpr std::size_t segment_of(std::size_t i) {
+		return std::bit_width((i >> first_shift) + 1) - 1;
+	}
+	static constexpr std::size_t segment_base(std::size_t s) {
+		return ((std::size_t{1} << s) - 1) << first_shift;
+	}
+	static constexpr std::size_t segment_size(std::size_t s) {
+		return FirstSegment << s;
+	}
+
+	/// @brief \p s 번 세그먼트와 그 비트맵이 없으면 할당해서 등록하고 반환한다.
+	std::pair<T*, word*> ensure_segment(std::size_t s) {
+		const std::size_t len = segment_size(s);
+
+		T* data = data_[s].load(std::memory_order_acquire);
+		if (data == nullptr) {
+			T* fresh = traits::allocate(alloc_, len);
+			if (data_[s].compare_exchange_strong(data, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				data = fresh;
+			} else {
+				traits::deallocate(alloc_, fresh, len);
+			}
+		}
+
+		word* ready = ready_[s].load(std::memory_order_acquire);
+		if (ready == nullptr) {
+			word_alloc wa(alloc_);
+			word* fresh = word_traits::allocate(wa, len / 64);
+			for (std::size_t w = 0; w < len / 64; ++w) {
+				word_traits::construct(wa, fresh + w, 0);
+			}
+			if (ready_[s].compare_exchange_strong(ready, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				ready = fresh;
+			} else {
+				destroy_n(wa, fresh, len / 64);
+				word_traits::deallocate(wa, fresh, len / 64);
+			}
+		}
+		return {data, ready};
+	}
+
+private:
+	[[no_unique_address]] alloc alloc_;
+	alignas(64) std::atomic<std::size_t> size_{0};
+	alignas(64) std::atomic<T*> data_[max_segments]{};
+	std::atomic<word*> ready_[max_segments]{};
+}; // class concurrent_vector
+
+} // namespace rds
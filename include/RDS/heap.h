@@ -1,53 +1,150 @@
 #pragma once
 
+#include <bit>
 #include <cstddef>
 #include <vector>
+#include <memory>
 #include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "Old/Simd.hpp"
 
 namespace rds {
 
-/// @brief vector를 사용하는 힙
+namespace detail {
+/// @brief 힙 속성이 `std::less` 이면 -1, `std::greater` 이면 1, 그 외에는 0
+template <class HeapProp, class T>
+inline constexpr int heap_order =
+	std::is_same_v<HeapProp, std::less<T>> || std::is_same_v<HeapProp, std::less<>> ? -1 :
+	std::is_same_v<HeapProp, std::greater<T>> || std::is_same_v<HeapProp, std::greater<>> ? 1 : 0;
+} // namespace detail
+
+/// @brief vector를 사용하는 d-진 힙
 /// @tparam HeapProp 적용할 힙 속성
-template <class T, class HeapProp=std::greater<T>>
+/// @tparam Arity 한 노드의 자식 수 (2, 4, 8)
+/// @tparam Alloc 원소 배열에 사용할 할당자 (예: \ref polymorphic_allocator)
+/// @details 노드 i 의 자식은 `Arity * i + 1` 부터 `Arity` 개가 연속해 있다. 자식이 많을수록 높이가 log_d n 으로
+/// 낮아지는 대신 한 단계마다 d - 1 번 비교하며, 원소가 많아 캐시 미스가 비교보다 비싸면 4가 대체로 유리하다.
+///
+/// `Arity` 가 2보다 크면 배열 앞에 `Arity - 1` 개의 빈 칸(기본 생성한 원소)을 두어 자식 묶음이 배열에서 `Arity` 개 단위
+/// 경계에서 시작하게 한다. `aligned_allocator<T, 64>` 처럼 캐시 라인 경계에 할당하고 `Arity * sizeof(T)` 가 64 이하이면
+/// 자식 묶음이 캐시 라인 하나에 들어간다. (T 가 기본 생성할 수 없으면 빈 칸을 두지 않는다)
+///
+/// T 가 32비트 정수, float, double 이고 힙 속성이 `std::less` / `std::greater` 이면 자식 중 하나를 SIMD 로 고른다.
+template <class T, class HeapProp=std::greater<T>, std::size_t Arity=2, class Alloc=std::allocator<T>>
 class Heap {
+	static_assert(Arity >= 2 && (Arity & (Arity - 1)) == 0, "Arity must be a power of two");
+
+	/// @brief 자식 묶음을 정렬하기 위해 배열 앞에 두는 빈 칸의 수
+	static constexpr std::size_t pad = Arity > 2 && std::is_default_constructible_v<T> ? Arity - 1 : 0;
+	/// @brief 자식 묶음에서 하나를 SIMD 로 고를 수 있는지 여부
+	static constexpr bool simd_children = [] {
+		if constexpr (Arity > 2 && detail::heap_order<HeapProp, T> != 0 && simd::IsOrderVectorizable_v<T>) {
+			return Arity * sizeof(T) % 16 == 0;
+		}
+		return false;
+	}();
+public:
+	using value_type = T;
+	using allocator_type = Alloc;
+	static constexpr std::size_t arity = Arity;
 public:
 	Heap() = default;
-	Heap(std::vector<T> const& vec) {
-		vec_.reserve(vec.capacity());
-		for (auto const& e: vec)
-			insert(e);
+	explicit Heap(Alloc const& alloc): vec_(alloc) {}
+	/// @brief \p vec 의 원소들을 복사해서 O(n)에 힙을 만든다.
+	Heap(std::vector<T, Alloc> const& vec): vec_(vec.get_allocator()) {
+		if (!vec.empty()) {
+			vec_.reserve(pad + vec.size());
+			vec_.resize(pad);
+			vec_.insert(vec_.end(), vec.begin(), vec.end());
+		}
+		heapify();
 	}
-	bool size() const {
-		return vec_.size();
+	/// @brief \p vec 의 버퍼를 복사 없이 넘겨받아 O(n)에 힙을 만든다.
+	/// @details 빈 칸을 두는 경우에는 원소들을 그만큼 뒤로 이동한다.
+	Heap(std::vector<T, Alloc>&& vec): vec_(std::move(vec)) {
+		if (pad != 0 && !vec_.empty()) {
+			vec_.insert(vec_.begin(), pad, T());
+		}
+		heapify();
+	}
+	std::size_t size() const {
+		return vec_.empty() ? 0 : vec_.size() - pad;
 	}
 	bool empty() const {
-		return vec_.empty();
+		return size() == 0;
 	}
 	// TODO T const& 를 반환하는게 의미가 있는지
 	T const& top() const {
-		return vec_.front();
+		return at(0);
 	}
 	void insert(T const& v) {
-		vec_.push_back();
-		bubble_up(get_li_i(), get_p_i(get_l_i()));
+		ensure_pad();
+		vec_.push_back(v);
+		bubble_up(get_l_i() - 1);
+	}
+	void insert(T&& v) {
+		ensure_pad();
+		vec_.push_back(std::move(v));
+		bubble_up(get_l_i() - 1);
+	}
+	/// @brief \p rg 의 원소들을 한 번에 추가한다.
+	/// @details 원소를 하나씩 추가하면 최악의 경우 k log(n + k)번 비교하고, 전체를 다시 힙으로 만들면
+	/// 2(n + k)번 이하로 비교한다. 추가하는 원소가 기존 힙에 비해 많아서 후자가 더 적으면 다시 힙으로 만든다.
+	template <std::ranges::input_range R>
+	void insert_range(R&& rg) {
+		auto const n = size();
+		ensure_pad();
+		if constexpr (std::ranges::sized_range<R>) {
+			vec_.reserve(pad + n + std::ranges::size(rg));
+		}
+		for (auto&& e: rg) {
+			vec_.push_back(std::forward<decltype(e)>(e));
+		}
+		auto const k = size() - n;
+		if (k * std::bit_width(size()) > 2 * size()) {
+			heapify();
+			return;
+		}
+		for (auto i = n; i < size(); ++i) {
+			bubble_up(i);
+		}
 	}
 	T extract() {
-		auto const ret = vec_.front();
-		vec_.front() = vec_.back();
+		auto ret = std::move(at(0));
+		auto last = std::move(vec_.back());
 		vec_.pop_back();
-		bubble_down(0);
+		if (!empty()) {
+			sift_down(0, std::move(last));
+		}
+		return ret;
+	}
+	/// @brief 맨 위 원소를 \p v 로 바꾼다. \ref extract 후 \ref insert 하는 것과 같지만 한 번만 내려보낸다.
+	/// @warning 힙이 비어있으면 안 된다.
+	T replace_top(T const& v) {
+		auto ret = std::move(at(0));
+		sift_down(0, v);
 		return ret;
 	}
+	T replace_top(T&& v) {
+		auto ret = std::move(at(0));
+		sift_down(0, std::move(v));
+		return ret;
+	}
+	/// @brief \p v 를 추가한 뒤 맨 위 원소를 꺼낸다. \p v 가 맨 위에 올 원소라면 힙을 건드리지 않는다.
 	T push_pop(T const& v) {
-		if (empty()) {
+		if (empty() || HeapProp()(v, top())) {
 			return v;
 		}
-		if (HeapProp()(v, top())) {
-			return v;
+		return replace_top(v);
+	}
+	T push_pop(T&& v) {
+		if (empty() || HeapProp()(v, top())) {
+			return std::move(v);
 		}
-		auto const ret = top();
-		vec_[0] = v;
-		bubble_down(0);
+		return replace_top(std::move(v));
 	}
 	std::size_t find_i(T const& v) const {
 		return find_i(v, std::equal_to<T>());
@@ -55,14 +152,15 @@ public:
 	template <class Compare>
 	std::size_t find_i(T const& v, Compare comp) const {
 		for (std::size_t i = 0; i < size(); ++i) {
-			if (comp(vec_[i], v)) {
+			if (comp(at(i), v)) {
 				return i;
 			}
 		}
 		return size();
 	}
+	/// @brief \p v 와 같은 원소를 하나 찾아서 지운다. 선형 탐색하므로 O(n)이며, 자주 지운다면 \ref IndexedHeap 을 사용한다.
 	bool del(T const& v) {
-		return del(v, equal_to<T>());
+		return del(v, std::equal_to<T>());
 	}
 	template <class Compare>
 	bool del(T const& v, Compare comp) {
@@ -71,13 +169,17 @@ public:
 		if (f_i == size()) {
 			return false;
 		}
-		vec_[f_i] = vec_[get_l_i()];
+		if (f_i == get_l_i() - 1) {
+			vec_.pop_back();
+			return true;
+		}
+		at(f_i) = std::move(vec_.back());
 		vec_.pop_back();
 		if (f_i != 0) {
 			auto const p_i = get_p_i(f_i);
 
-			if (!HeapProp()(vec_[p_i], vec_[f_i])) {
-				bubble_up(f_i, p_i);
+			if (!HeapProp()(at(p_i), at(f_i))) {
+				bubble_up(f_i);
 			} else {
 				bubble_down(f_i);
 			}
@@ -87,54 +189,522 @@ public:
 		return true;
 	}
 private:
-	void bubble_up(std::size_t c_i, std::size_t p_i) {
-		if (c_i == 0) {
+	/// @brief 자식이 있는 마지막 노드부터 거꾸로 내려보내서 전체를 힙으로 만든다. (Floyd, O(n))
+	void heapify() {
+		if (size() < 2) {
 			return;
 		}
-		auto& c = vec_[c_i];
-		auto& p = vec_[p_i];
-
-		if (!HeapProp()(c, p)) {
+		for (auto i = get_p_i(size() - 1) + 1; i-- > 0;) {
+			bubble_down(i);
+		}
+	}
+	/// @brief \p c_i 의 원소를 부모 쪽으로 올린다.
+	/// @details 원소를 빼낸 구멍(hole)을 올리면서 부모를 한 칸씩 내리고, 멈춘 자리에 원소를 한 번만 쓴다.
+	/// 단계마다 `std::swap` 하면 이동이 세 번이지만, 구멍을 옮기면 한 번이다.
+	void bubble_up(std::size_t c_i) {
+		if (c_i == 0 || !HeapProp()(at(c_i), at(get_p_i(c_i)))) {
 			return;
 		}
-
-		std::swap(c, p);
-		bubble_up(p_i, get_p_i(p_i));
+		auto v = std::move(at(c_i));
+		do {
+			auto const p_i = get_p_i(c_i);
+			at(c_i) = std::move(at(p_i));
+			c_i = p_i;
+		} while (c_i != 0 && HeapProp()(v, at(get_p_i(c_i))));
+		at(c_i) = std::move(v);
 	}
+	/// @brief \p p_i 의 원소를 자식 쪽으로 내린다.
 	void bubble_down(std::size_t p_i) {
-		auto const cl_i = get_cl_i(p_i);
+		auto const cf_i = get_cf_i(p_i);
 
-		if (!(cl_i < size())) {
+		if (!(cf_i < size())) {
 			return;
 		}
-		
-		auto t_i = cl_i; // target index
-		auto const cr_i = get_cr_i(p_i);
-
-		if (cr_i < size()) {
-			t_i = HeapProp()(vec_[cl_i], vec_[cr_i]) ? cl_i : cr_i;
+		auto const t_i = best_child(cf_i); // target index
+		if (!HeapProp()(at(t_i), at(p_i))) {
+			return;
+		}
+		auto v = std::move(at(p_i));
+		at(p_i) = std::move(at(t_i));
+		sift_down(t_i, std::move(v));
+	}
+	/// @brief 구멍 \p h_i 를 자식 쪽으로 내리면서 앞서는 자식을 한 칸씩 올리고, 멈춘 자리에 \p v 를 쓴다.
+	template <class V>
+	void sift_down(std::size_t h_i, V&& v) {
+		for (auto cf_i = get_cf_i(h_i); cf_i < size(); cf_i = get_cf_i(h_i)) {
+			auto const t_i = best_child(cf_i); // target index
+			if (!HeapProp()(at(t_i), v)) {
+				break;
+			}
+			at(h_i) = std::move(at(t_i));
+			h_i = t_i;
+		}
+		at(h_i) = std::forward<V>(v);
+	}
+	/// @brief \p cf_i 부터 시작하는 자식 묶음에서 힙 속성상 가장 앞서는 자식
+	std::size_t best_child(std::size_t cf_i) const {
+		if constexpr (simd_children) {
+			if (cf_i + Arity <= size()) {
+				return cf_i + simd::BlockMinMaxIndex<(detail::heap_order<HeapProp, T> > 0), Arity>(&at(cf_i));
+			}
 		}
+		auto const cl_i = cf_i + Arity < size() ? cf_i + Arity : size();
+		auto t_i = cf_i;
+		for (auto c_i = cf_i + 1; c_i < cl_i; ++c_i) {
+			if (HeapProp()(at(c_i), at(t_i))) {
+				t_i = c_i;
+			}
+		}
+		return t_i;
+	}
+	/// @brief 빈 배열에 원소를 추가하기 전에 빈 칸을 만든다.
+	void ensure_pad() {
+		if (pad != 0 && vec_.empty()) {
+			vec_.resize(pad);
+		}
+	}
+	T& at(std::size_t i) {
+		return vec_[pad + i];
+	}
+	T const& at(std::size_t i) const {
+		return vec_[pad + i];
+	}
+	std::size_t get_l_i() const {
+		return size();
+	}
+	std::size_t get_p_i(std::size_t i) const {
+		return --i / Arity;
+	}
+	/// @brief 첫 번째 자식의 위치
+	std::size_t get_cf_i(std::size_t i) const {
+		return Arity * i + 1;
+	}
+	std::vector<T, Alloc> vec_;
+}; // class Heap
 
-		if (HeapProp()(vec_[p_i], vec_[t_i])) {
+/// @brief 원소마다 핸들을 발급해서, 핸들로 원소를 찾아 우선순위를 바꾸거나 지울 수 있는 힙
+/// @tparam HeapProp 적용할 힙 속성
+/// @tparam Alloc 원소 배열과 위치 표에 사용할 할당자
+/// @details 힙 배열에는 원소와 핸들을 함께 저장하고, 핸들마다 힙 배열에서의 위치를 기록해 둔다.
+/// 원소가 움직일 때마다 위치 표를 갱신하므로 \ref update, \ref erase 는 O(log n), \ref contains 는 O(1)이다.
+/// @warning 꺼내거나 지운 원소의 핸들은 이후의 \ref insert 에서 다시 발급될 수 있다.
+template <class T, class HeapProp=std::greater<T>, class Alloc=std::allocator<T>>
+class IndexedHeap {
+public:
+	using handle = std::size_t;
+	static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+private:
+	struct node {
+		T value;
+		handle h;
+	};
+	using traits = std::allocator_traits<Alloc>;
+	using node_alloc = typename traits::template rebind_alloc<node>;
+	using index_alloc = typename traits::template rebind_alloc<std::size_t>;
+public:
+	IndexedHeap() = default;
+	explicit IndexedHeap(Alloc const& alloc): vec_(node_alloc(alloc)), pos_(index_alloc(alloc)), free_(index_alloc(alloc)) {}
+	std::size_t size() const {
+		return vec_.size();
+	}
+	bool empty() const {
+		return vec_.empty();
+	}
+	T const& top() const {
+		return vec_.front().value;
+	}
+	handle top_handle() const {
+		return vec_.front().h;
+	}
+	/// @brief \p h 가 가리키는 원소가 힙에 있는지 여부
+	bool contains(handle h) const {
+		return h < pos_.size() && pos_[h] != npos;
+	}
+	/// @brief \p h 가 가리키는 원소. \ref contains 가 true 여야 한다.
+	T const& operator[](handle h) const {
+		return vec_[pos_[h]].value;
+	}
+	/// @brief \p v 를 추가하고 그 핸들을 반환한다.
+	handle insert(T const& v) {
+		return push(v);
+	}
+	handle insert(T&& v) {
+		return push(std::move(v));
+	}
+	T extract() {
+		auto ret = std::move(vec_.front().value);
+		remove_at(0);
+		return ret;
+	}
+	/// @brief \p h 가 가리키는 원소를 \p v 로 바꾸고, 바뀐 우선순위에 맞게 옮긴다.
+	/// @return \p h 가 가리키는 원소가 없으면(이미 꺼냈거나 지운 핸들) 아무것도 하지 않고 false
+	bool update(handle h, T const& v) {
+		if (!contains(h)) {
+			return false;
+		}
+		auto const i = pos_[h];
+		auto const up = HeapProp()(v, vec_[i].value);
+		vec_[i].value = v;
+		if (up) {
+			bubble_up(i);
+		} else {
+			bubble_down(i);
+		}
+		return true;
+	}
+	/// @brief \p h 가 가리키는 원소를 지운다. 이미 없으면 false 를 반환한다.
+	bool erase(handle h) {
+		if (!contains(h)) {
+			return false;
+		}
+		remove_at(pos_[h]);
+		return true;
+	}
+	void clear() {
+		vec_.clear();
+		pos_.clear();
+		free_.clear();
+	}
+private:
+	template <class V>
+	handle push(V&& v) {
+		handle h;
+		if (free_.empty()) {
+			h = pos_.size();
+			pos_.push_back(npos);
+		} else {
+			h = free_.back();
+			free_.pop_back();
+		}
+		vec_.push_back(node{std::forward<V>(v), h});
+		bubble_up(size() - 1);
+		return h;
+	}
+	/// @brief \p i 번 노드를 지우고 마지막 노드로 그 자리를 채운다.
+	void remove_at(std::size_t i) {
+		auto const h = vec_[i].h;
+		pos_[h] = npos;
+		free_.push_back(h);
+		if (i == size() - 1) {
+			vec_.pop_back();
 			return;
 		}
+		vec_[i] = std::move(vec_.back());
+		vec_.pop_back();
+		if (i != 0 && HeapProp()(vec_[i].value, vec_[(i - 1) / 2].value)) {
+			bubble_up(i);
+		} else {
+			bubble_down(i);
+		}
+	}
+	/// @brief \p i 번 노드를 빼낸 구멍을 부모 쪽으로 옮긴 뒤, 멈춘 자리에 한 번만 쓴다.
+	void bubble_up(std::size_t i) {
+		auto n = std::move(vec_[i]);
+		while (i != 0) {
+			auto const p_i = (i - 1) / 2;
+			if (!HeapProp()(n.value, vec_[p_i].value)) {
+				break;
+			}
+			place(i, std::move(vec_[p_i]));
+			i = p_i;
+		}
+		place(i, std::move(n));
+	}
+	void bubble_down(std::size_t i) {
+		auto n = std::move(vec_[i]);
+		for (;;) {
+			auto t_i = 2 * i + 1;
+			if (!(t_i < size())) {
+				break;
+			}
+			if (t_i + 1 < size() && HeapProp()(vec_[t_i + 1].value, vec_[t_i].value)) {
+				++t_i;
+			}
+			if (!HeapProp()(vec_[t_i].value, n.value)) {
+				break;
+			}
+			place(i, std::move(vec_[t_i]));
+			i = t_i;
+		}
+		place(i, std::move(n));
+	}
+	void place(std::size_t i, node&& n) {
+		pos_[n.h] = i;
+		vec_[i] = std::move(n);
+	}
 
-		std::swap(vec_[p_i], vec_[t_i]);
-		bubble_down(t_i);j
+	std::vector<node, node_alloc> vec_;
+	std::vector<std::size_t, index_alloc> pos_;  ///< 핸들마다 힙 배열에서의 위치. 없으면 \ref npos
+	std::vector<std::size_t, index_alloc> free_; ///< 다시 발급할 핸들
+}; // class IndexedHeap
+
+/// @brief 노드를 연결해서 만드는 짝짓기 힙 (pairing heap)
+/// @tparam HeapProp 적용할 힙 속성
+/// @tparam Alloc 노드 할당에 사용할 할당자. 노드 형식으로 rebind 해서 사용한다.
+/// @details 노드마다 첫 자식, 다음 형제, 그리고 이전 노드(첫 자식이면 부모, 아니면 왼쪽 형제)를 가리킨다.
+/// 두 힙을 합치는 것은 두 뿌리 중 뒤지는 쪽을 앞서는 쪽의 첫 자식으로 붙이는 것뿐이므로 \ref insert, \ref meld 는 O(1)이다.
+/// \ref extract 는 뿌리의 자식들을 왼쪽부터 둘씩 합친 뒤 오른쪽부터 차례로 합치며(two-pass), 분할 상환 O(log n)이다.
+/// \ref decrease_key 는 노드를 부모에서 떼어 뿌리와 합치므로 배열 힙과 달리 원소를 옮기지 않는다.
+///
+/// 원소는 옮겨지지 않으므로 \ref insert 가 반환한 핸들은 그 원소를 꺼내거나 지울 때까지 유효하며,
+/// 할당자가 같은 힙끼리 \ref meld 하면 넘겨받은 원소의 핸들도 그대로 사용할 수 있다.
+template <class T, class HeapProp=std::greater<T>, class Alloc=std::allocator<T>>
+class PairingHeap {
+	struct node {
+		T value;
+		node* child = nullptr;
+		node* sibling = nullptr;
+		node* prev = nullptr; ///< 첫 자식이면 부모, 아니면 왼쪽 형제
+	};
+	using traits = std::allocator_traits<Alloc>;
+	using node_alloc = typename traits::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_alloc>;
+public:
+	using value_type = T;
+	using allocator_type = Alloc;
+	/// @brief \ref insert 가 반환하는 원소의 핸들
+	class handle {
+	public:
+		handle() = default;
+		explicit operator bool() const {
+			return n_ != nullptr;
+		}
+		bool operator==(handle const&) const = default;
+	private:
+		explicit handle(node* n): n_(n) {}
+		node* n_ = nullptr;
+		friend class PairingHeap;
+	};
+public:
+	PairingHeap() = default;
+	explicit PairingHeap(Alloc const& alloc): alloc_(alloc) {}
+	PairingHeap(PairingHeap const&) = delete;
+	PairingHeap& operator=(PairingHeap const&) = delete;
+	PairingHeap(PairingHeap&& o) noexcept: alloc_(std::move(o.alloc_)) {
+		steal(o);
 	}
-	std::size_t get_l_i() const {
-		return vec_.size();
+	PairingHeap& operator=(PairingHeap&& o) noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) {
+		if (this == &o) {
+			return *this;
+		}
+		clear();
+		if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+			alloc_ = std::move(o.alloc_);
+			steal(o);
+		} else if (node_traits::is_always_equal::value || alloc_ == o.alloc_) {
+			steal(o);
+		} else {
+			// 노드를 넘겨받을 수 없으므로 원소 단위로 이동한다.
+			meld(o);
+		}
+		return *this;
 	}
-	std::size_t get_p_i(std::size_t i) const {
-		return --i / 2;
+	~PairingHeap() {
+		clear();
+	}
+public:
+	Alloc get_allocator() const {
+		return Alloc(alloc_);
+	}
+	std::size_t size() const {
+		return size_;
+	}
+	bool empty() const {
+		return size_ == 0;
+	}
+	T const& top() const {
+		return root_->value;
+	}
+	handle top_handle() const {
+		return handle(root_);
+	}
+	/// @brief \p h 가 가리키는 원소
+	T const& operator[](handle h) const {
+		return h.n_->value;
+	}
+	handle insert(T const& v) {
+		return emplace(v);
 	}
-	std::size_t get_cl_i(std::size_t i) const {
-		return 2 * i + 1;
+	handle insert(T&& v) {
+		return emplace(std::move(v));
 	}
-	std::size_t get_cr_i(std::size_t i) const {
-		return get_cl_i(i) + 1;
+	template <class... Args>
+	handle emplace(Args&&... args) {
+		node* n = node_traits::allocate(alloc_, 1);
+		try {
+			node_traits::construct(alloc_, n, node{T(std::forward<Args>(args)...)});
+		} catch (...) {
+			node_traits::deallocate(alloc_, n, 1);
+			throw;
+		}
+		root_ = link(root_, n);
+		++size_;
+		return handle(n);
+	}
+	T extract() {
+		node* r = root_;
+		auto ret = std::move(r->value);
+		root_ = merge_pairs(r->child);
+		destroy(r);
+		--size_;
+		return ret;
+	}
+	/// @brief \p h 가 가리키는 원소를 \p v 로 바꾼다.
+	/// @warning \p v 는 힙 속성상 원래 값보다 뒤지면 안 된다. (최소 힙이면 작거나 같아야 한다)
+	void decrease_key(handle h, T const& v) {
+		h.n_->value = v;
+		promote(h.n_);
+	}
+	void decrease_key(handle h, T&& v) {
+		h.n_->value = std::move(v);
+		promote(h.n_);
+	}
+	/// @brief \p h 가 가리키는 원소를 지운다. 분할 상환 O(log n)
+	void erase(handle h) {
+		node* n = h.n_;
+		if (n == root_) {
+			root_ = merge_pairs(n->child);
+		} else {
+			cut(n);
+			root_ = link(root_, merge_pairs(n->child));
+		}
+		destroy(n);
+		--size_;
+	}
+	/// @brief \p o 의 원소들을 모두 가져온다. \p o 는 비게 된다.
+	/// @details 할당자가 같으면 뿌리끼리 합치는 O(1)이고 \p o 의 핸들도 유효하다.
+	/// 다르면 \p o 의 노드를 훑으면서 값을 하나씩 옮겨 넣으며(O(m)) \p o 의 핸들은 무효가 된다.
+	void meld(PairingHeap& o) {
+		if (this == &o || o.empty()) {
+			return;
+		}
+		node* r = std::exchange(o.root_, nullptr);
+		auto const m = std::exchange(o.size_, 0);
+		if (node_traits::is_always_equal::value || alloc_ == o.alloc_) {
+			root_ = link(root_, r);
+			size_ += m;
+			return;
+		}
+		o.consume(r, [this](node* n) {
+			insert(std::move(n->value));
+		});
+	}
+	void clear() {
+		consume(std::exchange(root_, nullptr), ignore{});
+		size_ = 0;
 	}
-	std::vector<T> vec_;
-};
+private:
+	/// @brief 두 뿌리를 합친 뿌리. 뒤지는 쪽이 앞서는 쪽의 첫 자식이 된다.
+	node* link(node* a, node* b) {
+		if (a == nullptr) {
+			return b;
+		}
+		if (b == nullptr) {
+			return a;
+		}
+		if (HeapProp()(b->value, a->value)) {
+			std::swap(a, b);
+		}
+		b->sibling = a->child;
+		if (a->child != nullptr) {
+			a->child->prev = b;
+		}
+		b->prev = a;
+		a->child = b;
+		return a;
+	}
+	/// @brief 형제 목록 \p first 를 왼쪽부터 둘씩 합친 뒤, 그 결과들을 오른쪽부터 합친다.
+	node* merge_pairs(node* first) {
+		if (first == nullptr) {
+			return nullptr;
+		}
+		node* pairs = nullptr; // 둘씩 합친 결과. 역순으로 쌓인다.
+		while (first != nullptr) {
+			node* a = first;
+			node* b = a->sibling;
+			first = b != nullptr ? b->sibling : nullptr;
+			a->sibling = nullptr;
+			if (b != nullptr) {
+				b->sibling = nullptr;
+			}
+			node* m = link(a, b);
+			m->sibling = pairs;
+			pairs = m;
+		}
+		node* r = pairs;
+		pairs = pairs->sibling;
+		r->sibling = nullptr;
+		while (pairs != nullptr) {
+			node* next = pairs->sibling;
+			pairs->sibling = nullptr;
+			r = link(r, pairs);
+			pairs = next;
+		}
+		r->prev = nullptr;
+		return r;
+	}
+	/// @brief 뿌리가 아닌 \p n 을 부모에서 떼어낸다. \p n 의 자식들은 그대로 따라온다.
+	void cut(node* n) {
+		if (n->prev->child == n) {
+			n->prev->child = n->sibling;
+		} else {
+			n->prev->sibling = n->sibling;
+		}
+		if (n->sibling != nullptr) {
+			n->sibling->prev = n->prev;
+		}
+		n->sibling = nullptr;
+		n->prev = nullptr;
+	}
+	/// @brief 값이 앞서게 바뀐 \p n 을 떼어서 뿌리와 합친다.
+	void promote(node* n) {
+		if (n != root_) {
+			cut(n);
+			root_ = link(root_, n);
+		}
+	}
+	/// @brief 노드를 해제하기만 할 때 \ref consume 에 넘기는 함수 객체
+	struct ignore {
+		void operator()(node*) const {}
+	};
+	/// @brief \p r 을 뿌리로 하는 트리의 노드마다 \p f 를 호출한 뒤 해제한다.
+	/// @details 자식 목록을 형제 목록 앞에 이어 붙이면서 한 줄로 훑으므로 재귀 없이 O(n)이다.
+	/// \p f 가 예외를 던지면 남은 노드를 모두 해제하고 다시 던진다.
+	template <class F>
+	void consume(node* r, F&& f) {
+		for (node* n = r; n != nullptr;) {
+			if (n->child != nullptr) {
+				node* last = n->child;
+				while (last->sibling != nullptr) {
+					last = last->sibling;
+				}
+				last->sibling = n->sibling;
+				n->sibling = n->child;
+			}
+			node* next = n->sibling;
+			try {
+				f(n);
+			} catch (...) {
+				destroy(n);
+				consume(next, ignore{});
+				throw;
+			}
+			destroy(n);
+			n = next;
+		}
+	}
+	void destroy(node* n) {
+		node_traits::destroy(alloc_, n);
+		node_traits::deallocate(alloc_, n, 1);
+	}
+	void steal(PairingHeap& o) {
+		root_ = std::exchange(o.root_, nullptr);
+		size_ = std::exchange(o.size_, 0);
+	}
+
+	[[no_unique_address]] node_alloc alloc_;
+	node* root_ = nullptr;
+	std::size_t size_ = 0;
+}; // class PairingHeap
 
-}; // namespace rds;
\ No newline at end of file
+} // namespace rds
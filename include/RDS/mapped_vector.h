@@ -0,0 +1,270 @@
+#pragma once
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "vector.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rds {
+
+/// @brief \ref mapped_vector 로 파일을 여는 방식
+enum class map_mode {
+	read_only,  ///< 읽기만 한다. 여러 프로세스가 같은 페이지 캐시를 공유한다.
+	read_write, ///< 원소를 바꾸거나 추가할 수 있다. 바꾼 내용은 파일에 반영된다.
+};
+
+/// @brief 파일을 메모리에 매핑해서 저장소로 사용하는 동적 배열 템플릿 클래스
+/// @tparam T trivially copyable 한 원소 형식. 파일에는 원소들이 머리말 없이 그대로 저장된다.
+/// @details 파일을 읽어서 역직렬화하는 대신 `mmap` 으로 매핑하므로, 여는 비용은 원소 수와 무관하고
+/// 실제로 접근한 페이지만 디스크에서 읽는다. \ref map_mode::read_only 로 연 매핑은 같은 파일을 연
+/// 다른 프로세스와 페이지 캐시를 공유한다.
+///
+/// \ref map_mode::read_write 에서는 \ref vector 처럼 원소를 추가할 수 있다. 용량이 부족하면 `ftruncate` 로
+/// 파일을 늘리고 다시 매핑하며(Linux 에서는 `mremap`), 닫을 때 파일을 원소 수에 맞게 줄인다.
+/// @warning 다시 매핑하면 원소의 주소가 바뀔 수 있다. 닫히기 전에 프로세스가 끝나면 파일 끝에 여분의 0이 남는다.
+/// 원소를 바꾸는 연산은 \ref map_mode::read_write 로 열었을 때만 호출할 수 있다.
+template <class T>
+class mapped_vector {
+	static_assert(std::is_trivially_copyable_v<T>, "mapped_vector requires a trivially copyable type");
+public:
+	using value_type = T;
+	using iterator = vector_it<T>;
+	using const_iterator = vector_it<const T>;
+public:
+	mapped_vector() = default;
+	/// @brief \p path 의 파일을 \p mode 로 연다. \ref map_mode::read_write 이면 파일이 없을 때 새로 만든다.
+	explicit mapped_vector(const char* path, map_mode mode=map_mode::read_only) {
+		open(path, mode);
+	}
+	mapped_vector(const mapped_vector&) = delete;
+	mapped_vector& operator=(const mapped_vector&) = delete;
+	mapped_vector(mapped_vector&& o) noexcept:
+		fd_(std::exchange(o.fd_, -1)), mode_(o.mode_), data_(std::exchange(o.data_, nullptr)),
+		size_(std::exchange(o.size_, 0)), capacity_(std::exchange(o.capacity_, 0)) {}
+	mapped_vector& operator=(mapped_vector&& o) noexcept {
+		if (this != &o) {
+			close();
+			fd_ = std::exchange(o.fd_, -1);
+			mode_ = o.mode_;
+			data_ = std::exchange(o.data_, nullptr);
+			size_ = std::exchange(o.size_, 0);
+			capacity_ = std::exchange(o.capacity_, 0);
+		}
+		return *this;
+	}
+	~mapped_vector() {
+		close();
+	}
+public:
+	/// @brief \p path 의 파일을 매핑한다. 이미 열린 파일이 있으면 먼저 닫는다.
+	/// @throws std::system_error 파일을 열거나 매핑하지 못했거나, 파일 크기가 `sizeof(T)` 의 배수가 아닐 때
+	void open(const char* path, map_mode mode=map_mode::read_only) {
+		close();
+		const int fd = mode == map_mode::read_only ? ::open(path, O_RDONLY | O_CLOEXEC) : ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+		if (fd < 0) {
+			throw std::system_error(errno, std::generic_category(), "mapped_vector: open");
+		}
+		struct stat st;
+		if (::fstat(fd, &st) != 0) {
+			const int err = errno;
+			::close(fd);
+			throw std::system_error(err, std::generic_category(), "mapped_vector: fstat");
+		}
+		if (st.st_size % sizeof(T) != 0) {
+			::close(fd);
+			throw std::system_error(EINVAL, std::generic_category(), "mapped_vector: file size is not a multiple of the element size");
+		}
+		fd_ = fd;
+		mode_ = mode;
+		const std::size_t n = static_cast<std::size_t>(st.st_size) / sizeof(T);
+		try {
+			remap(n);
+		} catch (...) {
+			::close(std::exchange(fd_, -1));
+			throw;
+		}
+		size_ = n;
+	}
+	/// @brief 매핑을 해제하고 파일을 닫는다. \ref map_mode::read_write 이면 파일을 원소 수에 맞게 줄인다.
+	void close() noexcept {
+		if (fd_ < 0) {
+			return;
+		}
+		if (data_) {
+			::munmap(data_, capacity_ * sizeof(T));
+		}
+		if (mode_ == map_mode::read_write) {
+			[[maybe_unused]] const int r = ::ftruncate(fd_, static_cast<off_t>(size_ * sizeof(T)));
+		}
+		::close(fd_);
+		fd_ = -1;
+		data_ = nullptr;
+		size_ = 0;
+		capacity_ = 0;
+	}
+	bool is_open() const {
+		return fd_ >= 0;
+	}
+	map_mode mode() const {
+		return mode_;
+	}
+	/// @brief 바꾼 내용을 파일에 기록할 때까지 기다린다.
+	void sync() {
+		if (data_ && ::msync(data_, size_ * sizeof(T), MS_SYNC) != 0) {
+			throw std::system_error(errno, std::generic_category(), "mapped_vector: msync");
+		}
+	}
+	/// @brief 모든 원소를 곧 읽을 것이라고 커널에 알려서, 페이지를 미리 읽어들이게 한다.
+	void prefetch() const {
+		if (data_) {
+			::madvise(data_, size_ * sizeof(T), MADV_WILLNEED);
+		}
+	}
+public:
+	std::size_t size() const {
+		return size_;
+	}
+	std::size_t capacity() const {
+		return capacity_;
+	}
+	bool empty() const {
+		return size_ == 0;
+	}
+	/// @brief 파일과 매핑을 \p cap 개를 담을 수 있는 크기로 늘린다.
+	void reserve(std::size_t cap) {
+		if (cap <= capacity_) {
+			return;
+		}
+		if (::ftruncate(fd_, static_cast<off_t>(cap * sizeof(T))) != 0) {
+			throw std::system_error(errno, std::generic_category(), "mapped_vector: ftruncate");
+		}
+		remap(cap);
+	}
+public: // 접근
+	const T& operator[](std::size_t i) const {
+		return data_[i];
+	}
+	T& operator[](std::size_t i) {
+		return data_[i];
+	}
+	const T& front() const {
+		return data_[0];
+	}
+	T& front() {
+		return data_[0];
+	}
+	const T& back() const {
+		return data_[size_ - 1];
+	}
+	T& back() {
+		return data_[size_ - 1];
+	}
+	const T* data() const {
+		return data_;
+	}
+	T* data() {
+		return data_;
+	}
+public: // 수정
+	void push_back(const T& v) {
+		emplace_back(v);
+	}
+	/// @brief 맨 뒤에 원소를 생성한다. 용량이 부족하면 파일을 두 배로 늘린다.
+	template <class... Args>
+	T& emplace_back(Args&&... args) {
+		if (size_ == capacity_) {
+			// 인자가 이 벡터의 원소를 참조할 수 있으므로, 다시 매핑하기 전에 먼저 생성한다.
+			T t(std::forward<Args>(args)...);
+			reserve(next_capacity());
+			return *::new (static_cast<void*>(data_ + size_++)) T(t);
+		}
+		return *::new (static_cast<void*>(data_ + size_++)) T(std::forward<Args>(args)...);
+	}
+	void pop_back() {
+		--size_;
+	}
+	/// @brief 크기를 \p n 으로 바꾼다. 늘어난 원소는 \p val 로 채운다.
+	void resize(std::size_t n, const T& val=T()) {
+		if (n > size_) {
+			const T v = val;
+			reserve(n);
+			for (std::size_t i = size_; i < n; ++i) {
+				::new (static_cast<void*>(data_ + i)) T(v);
+			}
+		}
+		size_ = n;
+	}
+	void clear() {
+		size_ = 0;
+	}
+public: // 반복자
+	iterator begin() {
+		return iterator(data_, 0);
+	}
+	iterator end() {
+		return iterator(data_, size_);
+	}
+	const_iterator begin() const {
+		return const_iterator(data_, 0);
+	}
+	const_iterator end() const {
+		return const_iterator(data_, size_);
+	}
+	const_iterator cbegin() const {
+		return begin();
+	}
+	const_iterator cend() const {
+		return end();
+	}
+private:
+	/// @brief 한 번에 한 페이지 이상씩 늘어나도록 다음 용량을 정한다.
+	std::size_t next_capacity() const {
+		const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+		const std::size_t cap = growth_x2::next(capacity_);
+		return cap * sizeof(T) < page ? (page + sizeof(T) - 1) / sizeof(T) : cap;
+	}
+	/// @brief 파일의 앞쪽 \p cap 개를 다시 매핑한다. 파일은 그 크기 이상이어야 한다.
+	void remap(std::size_t cap) {
+		if (cap == 0) {
+			return;
+		}
+		const int prot = mode_ == map_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+		void* p;
+#if defined(__linux__)
+		if (data_) {
+			p = ::mremap(data_, capacity_ * sizeof(T), cap * sizeof(T), MREMAP_MAYMOVE);
+		} else {
+			p = ::mmap(nullptr, cap * sizeof(T), prot, MAP_SHARED, fd_, 0);
+		}
+#else
+		p = ::mmap(nullptr, cap * sizeof(T), prot, MAP_SHARED, fd_, 0);
+		if (p != MAP_FAILED && data_) {
+			::munmap(data_, capacity_ * sizeof(T));
+		}
+#endif
+		if (p == MAP_FAILED) {
+			throw std::system_error(errno, std::generic_category(), "mapped_vector: mmap");
+		}
+		data_ = static_cast<T*>(p);
+		capacity_ = cap;
+	}
+
+private:
+	int fd_ = -1;
+	map_mode mode_ = map_mode::read_only;
+	T* data_ = nullptr;
+	std::size_t size_ = 0;
+	std::size_t capacity_ = 0;
+}; // class mapped_vector
+
+} // namespace rds
+
+#endif
@@ -0,0 +1,344 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "allocator.h"
+#include "arena.h"
+
+namespace rds {
+
+/// @brief 실행 중에 고를 수 있는 메모리 자원의 기반 클래스
+/// @details 컨테이너는 \ref polymorphic_allocator 를 통해 자원을 사용하므로, 자원을 바꾸어도 컨테이너의 타입은 바뀌지 않는다.
+/// 파생 클래스는 `do_allocate`, `do_deallocate`, `do_is_equal` 을 구현한다.
+class memory_resource {
+public:
+	virtual ~memory_resource() = default;
+
+	void* allocate(std::size_t bytes, std::size_t align=alignof(std::max_align_t)) {
+		return do_allocate(bytes, align);
+	}
+	void deallocate(void* p, std::size_t bytes, std::size_t align=alignof(std::max_align_t)) {
+		do_deallocate(p, bytes, align);
+	}
+	/// @brief 한 쪽에서 할당한 메모리를 다른 쪽에서 해제할 수 있으면 true
+	bool is_equal(const memory_resource& o) const noexcept {
+		return do_is_equal(o);
+	}
+private:
+	virtual void* do_allocate(std::size_t bytes, std::size_t align) = 0;
+	virtual void do_deallocate(void* p, std::size_t bytes, std::size_t align) = 0;
+	virtual bool do_is_equal(const memory_resource& o) const noexcept = 0;
+}; // class memory_resource
+
+inline bool operator==(const memory_resource& l, const memory_resource& r) noexcept {
+	return &l == &r || l.is_equal(r);
+}
+
+inline bool operator!=(const memory_resource& l, const memory_resource& r) noexcept {
+	return !(l == r);
+}
+
+/// @brief 정렬과 크기를 받는 전역 `::operator new`/`delete` 를 사용하는 자원
+inline memory_resource* new_delete_resource() noexcept {
+	class new_delete final: public memory_resource {
+		void* do_allocate(std::size_t bytes, std::size_t align) override {
+			return ::operator new(bytes, std::align_val_t(align));
+		}
+		void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+			::operator delete(p, bytes, std::align_val_t(align));
+		}
+		bool do_is_equal(const memory_resource& o) const noexcept override {
+			return this == &o;
+		}
+	};
+	static new_delete r;
+	return &r;
+}
+
+namespace detail {
+inline std::atomic<memory_resource*>& default_resource() noexcept {
+	static std::atomic<memory_resource*> r{new_delete_resource()};
+	return r;
+}
+} // namespace detail
+
+/// @brief 자원을 지정하지 않은 \ref polymorphic_allocator 가 사용하는 자원을 반환
+inline memory_resource* get_default_resource() noexcept {
+	return detail::default_resource().load(std::memory_order_acquire);
+}
+
+/// @brief 기본 자원을 \p r 로 바꾸고 이전 자원을 반환한다. \p r 이 nullptr 이면 \ref new_delete_resource 로 되돌린다.
+inline memory_resource* set_default_resource(memory_resource* r) noexcept {
+	return detail::default_resource().exchange(r ? r : new_delete_resource(), std::memory_order_acq_rel);
+}
+
+/// @brief \ref arena 를 사용하는 단조 증가 자원
+/// @details 요청 하나의 수명 동안만 쓰는 데이터에 사용한다. 개별 해제는 하지 않고 \ref release 나 소멸 시 한 번에 반환한다.
+/// @note 스레드 안전하지 않다.
+class monotonic_buffer_resource: public memory_resource {
+public:
+	explicit monotonic_buffer_resource(std::size_t chunk_size=arena::default_chunk_size): arena_(chunk_size) {}
+	monotonic_buffer_resource(void* buf, std::size_t size, std::size_t chunk_size=arena::default_chunk_size):
+		arena_(buf, size, chunk_size) {}
+	monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+	monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+	void release() {
+		arena_.release();
+	}
+	arena& upstream_arena() {
+		return arena_;
+	}
+private:
+	void* do_allocate(std::size_t bytes, std::size_t align) override {
+		return arena_.allocate(bytes, align);
+	}
+	void do_deallocate(void*, std::size_t, std::size_t) override {}
+	bool do_is_equal(const memory_resource& o) const noexcept override {
+		return this == &o;
+	}
+private:
+	arena arena_;
+}; // class monotonic_buffer_resource
+
+/// @brief \ref unsynchronized_pool_resource 의 설정
+struct pool_options {
+	/// @brief 상위 자원에서 한 번에 받아오는 청크에 들어가는 블록 수의 상한
+	std::size_t max_blocks_per_chunk = 1024;
+	/// @brief 풀에서 처리할 가장 큰 블록. 이보다 큰 요청은 상위 자원으로 넘긴다.
+	std::size_t largest_required_pool_block = 4096;
+};
+
+/// @brief 2의 거듭제곱 크기 등급마다 자유 리스트를 두는 풀 자원
+/// @details 크기 등급은 8 바이트부터 `largest_required_pool_block` 까지이며, 요청은 `max(bytes, align)` 이상인
+/// 가장 작은 등급에서 O(1) 로 처리된다. 청크는 블록 크기에 맞춰 정렬해서 받으므로 블록은 자기 크기만큼 정렬된다.
+/// 한 등급의 청크는 블록 16개부터 시작해서 `max_blocks_per_chunk` 까지 두 배씩 커진다.
+/// 받아온 청크는 \ref release 나 소멸 시 상위 자원에 반환한다.
+/// @note 스레드 안전하지 않다. 여러 스레드에서 사용하려면 \ref synchronized_pool_resource 를 사용한다.
+class unsynchronized_pool_resource: public memory_resource {
+	static constexpr std::size_t min_block = 8;
+	static constexpr std::size_t max_pools = 16; // 등급은 최대 max_pools + 1 개: 8 B ~ 512 KiB (8 << 16)
+public:
+	explicit unsynchronized_pool_resource(pool_options opts={}, memory_resource* upstream=get_default_resource()):
+		upstream_(upstream), max_blocks_per_chunk_(opts.max_blocks_per_chunk < 16 ? 16 : opts.max_blocks_per_chunk) {
+		std::size_t largest = min_block;
+		while (largest < opts.largest_required_pool_block && pool_count_ < max_pools) {
+			largest *= 2;
+			++pool_count_;
+		}
+		++pool_count_;
+		largest_ = largest;
+	}
+	explicit unsynchronized_pool_resource(memory_resource* upstream): unsynchronized_pool_resource(pool_options{}, upstream) {}
+	unsynchronized_pool_resource(const unsynchronized_pool_resource&) = delete;
+	unsynchronized_pool_resource& operator=(const unsynchronized_pool_resource&) = delete;
+	~unsynchronized_pool_resource() override {
+		release();
+	}
+
+	/// @brief 모든 청크를 상위 자원에 반환한다.
+	/// @warning 이 자원에서 할당된 모든 메모리가 무효화된다.
+	void release() {
+		for (std::size_t i = 0; i < pool_count_; ++i) {
+			auto& pool = pools_[i];
+			const std::size_t block = block_size(i);
+			while (pool.chunks) {
+				chunk* next = pool.chunks->next;
+				upstream_->deallocate(pool.chunks->begin, pool.chunks->bytes, block);
+				pool.chunks = next;
+			}
+			pool = pool_t{};
+		}
+	}
+	memory_resource* upstream_resource() const {
+		return upstream_;
+	}
+	pool_options options() const {
+		return {max_blocks_per_chunk_, largest_};
+	}
+private:
+	struct free_block {
+		free_block* next;
+	};
+	/// @brief 청크의 끝에 붙는 머리말. 블록이 청크의 시작부터 정렬되도록 끝에 둔다.
+	struct chunk {
+		chunk* next;
+		void* begin;
+		std::size_t bytes;
+	};
+	struct pool_t {
+		free_block* free = nullptr;
+		chunk* chunks = nullptr;
+		std::size_t next_blocks = 16;
+	};
+
+	static constexpr std::size_t block_size(std::size_t idx) {
+		return min_block << idx;
+	}
+	static std::size_t pool_index(std::size_t bytes) {
+		std::size_t idx = 0;
+		while (block_size(idx) < bytes)
+			++idx;
+		return idx;
+	}
+
+	void* do_allocate(std::size_t bytes, std::size_t align) override {
+		const std::size_t need = bytes > align ? bytes : align;
+		if (need > largest_) {
+			return upstream_->allocate(bytes, align);
+		}
+		auto& pool = pools_[pool_index(need)];
+		if (pool.free == nullptr) {
+			refill(pool, pool_index(need));
+		}
+		free_block* b = pool.free;
+		pool.free = b->next;
+		return b;
+	}
+	void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+		const std::size_t need = bytes > align ? bytes : align;
+		if (need > largest_) {
+			upstream_->deallocate(p, bytes, align);
+			return;
+		}
+		auto& pool = pools_[pool_index(need)];
+		auto* b = static_cast<free_block*>(p);
+		b->next = pool.free;
+		pool.free = b;
+	}
+	bool do_is_equal(const memory_resource& o) const noexcept override {
+		return this == &o;
+	}
+
+	void refill(pool_t& pool, std::size_t idx) {
+		const std::size_t block = block_size(idx);
+		const std::size_t n = pool.next_blocks;
+		const std::size_t bytes = n * block + sizeof(chunk);
+		auto* begin = static_cast<std::byte*>(upstream_->allocate(bytes, block));
+
+		auto* c = ::new (begin + n * block) chunk{pool.chunks, begin, bytes};
+		pool.chunks = c;
+		for (std::size_t i = n; i > 0; --i) {
+			auto* b = reinterpret_cast<free_block*>(begin + (i - 1) * block);
+			b->next = pool.free;
+			pool.free = b;
+		}
+		if (pool.next_blocks < max_blocks_per_chunk_) {
+			pool.next_blocks *= 2;
+		}
+	}
+private:
+	memory_resource* upstream_;
+	std::size_t max_blocks_per_chunk_;
+	std::size_t largest_ = min_block;
+	std::size_t pool_count_ = 0;
+	std::array<pool_t, max_pools + 1> pools_{};
+}; // class unsynchronized_pool_resource
+
+/// @brief 잠금으로 보호되는 \ref unsynchronized_pool_resource
+/// @details 오래 사는 데이터를 여러 스레드에서 공유할 때 사용한다. 모든 요청이 하나의 잠금을 거치므로,
+/// 스레드별 캐시가 필요하면 \ref thread_cache_allocator 를 사용한다.
+class synchronized_pool_resource: public memory_resource {
+public:
+	explicit synchronized_pool_resource(pool_options opts={}, memory_resource* upstream=get_default_resource()): pool_(opts, upstream) {}
+	explicit synchronized_pool_resource(memory_resource* upstream): pool_(upstream) {}
+
+	void release() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		pool_.release();
+	}
+	memory_resource* upstream_resource() const {
+		return pool_.upstream_resource();
+	}
+	pool_options options() const {
+		return pool_.options();
+	}
+private:
+	void* do_allocate(std::size_t bytes, std::size_t align) override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return pool_.allocate(bytes, align);
+	}
+	void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		pool_.deallocate(p, bytes, align);
+	}
+	bool do_is_equal(const memory_resource& o) const noexcept override {
+		return this == &o;
+	}
+private:
+	std::mutex mutex_;
+	unsynchronized_pool_resource pool_;
+}; // class synchronized_pool_resource
+
+/// @brief \ref memory_resource 에서 메모리를 받아오는 할당자
+/// @details \ref allocator 와 같은 인터페이스를 제공하므로 컨테이너의 할당자 자리에 넣어 사용하며,
+/// 자원은 실행 중에 정한다. 자원을 지정하지 않으면 \ref get_default_resource 를 사용한다.
+/// 컨테이너를 복사해도 자원은 전파되지 않고, 새 컨테이너는 기본 자원을 사용한다.
+/// @warning 자원은 이 할당자와 이 할당자를 사용하는 컨테이너보다 오래 살아야 한다.
+template <class T>
+class polymorphic_allocator {
+public:
+	using value_type = T;
+	using pointer = T*;
+	using size_type = std::size_t;
+public:
+	polymorphic_allocator() noexcept: resource_(get_default_resource()) {}
+	polymorphic_allocator(memory_resource* r) noexcept: resource_(r) {}
+	template <class U>
+	polymorphic_allocator(const polymorphic_allocator<U>& o) noexcept: resource_(o.resource()) {}
+	polymorphic_allocator& operator=(const polymorphic_allocator&) = delete;
+
+	size_type max_size() const {
+		return size_type(-1) / sizeof(T);
+	}
+
+	pointer allocate(size_type n) {
+		if (n > max_size()) {
+			throw std::bad_alloc();
+		}
+
+		return static_cast<pointer>(resource_->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(pointer p, size_type n) {
+		resource_->deallocate(p, n * sizeof(T), alignof(T));
+	}
+
+	template <class U, class... Args>
+	void construct(U* p, Args&&... args) {
+		::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+	}
+
+	template <class U>
+	void destroy(U* p) {
+		p->~U();
+	}
+
+	polymorphic_allocator select_on_container_copy_construction() const {
+		return polymorphic_allocator();
+	}
+
+	memory_resource* resource() const {
+		return resource_;
+	}
+private:
+	memory_resource* resource_;
+}; // class polymorphic_allocator
+
+template <class T, class U>
+bool operator==(const polymorphic_allocator<T>& l, const polymorphic_allocator<U>& r) {
+	return *l.resource() == *r.resource();
+}
+
+template <class T, class U>
+bool operator!=(const polymorphic_allocator<T>& l, const polymorphic_allocator<U>& r) {
+	return !(l == r);
+}
+
+} // namespace rds
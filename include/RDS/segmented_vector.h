@@ -0,0 +1,333 @@
+#pragma once
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "allocator.h"
+#include "vector.h"
+
+namespace rds {
+
+/// @brief \ref segmented_vector 의 반복자
+/// @details \ref vector_it 과 같이 시작 위치(청크 목록)와 오프셋으로 원소를 가리키며,
+/// 역참조할 때 오프셋을 청크 번호와 청크 안의 위치로 나눈다.
+template <class T, std::size_t ChunkSize>
+class segmented_vector_it {
+	static constexpr std::size_t shift = std::countr_zero(ChunkSize);
+	static constexpr std::size_t mask = ChunkSize - 1;
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = std::remove_const_t<T>;
+	using difference_type = std::ptrdiff_t;
+	using pointer = T*;
+	using reference = T&;
+public:
+	constexpr segmented_vector_it(): chunks_(nullptr), off_(0) {}
+	constexpr segmented_vector_it(T* const* chunks, std::size_t off=0): chunks_(chunks), off_(off) {}
+	template <class U>
+	requires std::is_same_v<const U, T>
+	constexpr segmented_vector_it(const segmented_vector_it<U, ChunkSize>& o): chunks_(o.chunks()), off_(o.offset()) {}
+public:
+	constexpr reference operator*() const {
+		return chunks_[off_ >> shift][off_ & mask];
+	}
+	constexpr pointer operator->() const {
+		return &**this;
+	}
+	constexpr reference operator[](difference_type diff) const {
+		return *(*this + diff);
+	}
+public:
+	constexpr auto operator<=>(const segmented_vector_it& o) const {
+		return off_ <=> o.off_;
+	}
+	constexpr bool operator==(const segmented_vector_it& o) const {
+		return off_ == o.off_;
+	}
+public:
+	constexpr segmented_vector_it& operator+=(difference_type diff) {
+		off_ += diff;
+		return *this;
+	}
+	constexpr segmented_vector_it& operator-=(difference_type diff) {
+		off_ -= diff;
+		return *this;
+	}
+	constexpr segmented_vector_it& operator++() {
+		++off_;
+		return *this;
+	}
+	constexpr segmented_vector_it& operator--() {
+		--off_;
+		return *this;
+	}
+	constexpr segmented_vector_it operator++(int) {
+		auto t(*this);
+		++(*this);
+		return t;
+	}
+	constexpr segmented_vector_it operator--(int) {
+		auto t(*this);
+		--(*this);
+		return t;
+	}
+	constexpr segmented_vector_it operator+(difference_type diff) const {
+		return segmented_vector_it(chunks_, off_ + diff);
+	}
+	friend constexpr segmented_vector_it operator+(difference_type diff, const segmented_vector_it& it) {
+		return it + diff;
+	}
+	constexpr segmented_vector_it operator-(difference_type diff) const {
+		return segmented_vector_it(chunks_, off_ - diff);
+	}
+	constexpr difference_type operator-(const segmented_vector_it& o) const {
+		return static_cast<difference_type>(off_) - static_cast<difference_type>(o.off_);
+	}
+public:
+	constexpr T* const* chunks() const {
+		return chunks_;
+	}
+	constexpr std::size_t offset() const {
+		return off_;
+	}
+private:
+	T* const* chunks_;
+	std::size_t off_;
+}; // class segmented_vector_it
+
+/// @brief 한 청크에 들어가는 원소 수의 기본값. 청크가 4 KiB 안팎이 되도록 잡는다. (최소 16)
+template <class T>
+inline constexpr std::size_t default_chunk_elems = std::bit_floor(4096 / sizeof(T) > 16 ? 4096 / sizeof(T) : std::size_t{16});
+
+/// @brief 고정 크기 청크들과 청크 목록으로 이루어진 동적 배열 템플릿 클래스
+/// @tparam ChunkSize 한 청크에 들어가는 원소 수 (2의 거듭제곱)
+/// @tparam alloc 원소와 청크 목록의 할당에 사용할 할당자
+/// @details 원소는 한 번 생성되면 옮겨지지 않으므로, 원소의 주소와 참조는 그 원소가 지워지기 전까지 유효하다.
+/// 추가할 때는 청크 하나를 할당하거나 청크 목록(포인터 배열)을 늘리는 것이 전부이므로, \ref vector 처럼
+/// 모든 원소를 재배치하는 지연이 생기지 않는다. 임의 접근은 시프트와 마스크 한 번으로 O(1)이다.
+/// 비운 청크는 \ref shrink_to_fit 을 호출할 때까지 재사용을 위해 남겨둔다.
+/// @warning 반복자는 청크 목록을 가리키므로, 청크 목록이 늘어나는 추가 이후에는 무효화된다. (원소의 참조는 유효하다)
+template <class T, std::size_t ChunkSize=default_chunk_elems<T>, class alloc=allocator<T>>
+class segmented_vector {
+	static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+	static constexpr std::size_t shift = std::countr_zero(ChunkSize);
+	static constexpr std::size_t mask = ChunkSize - 1;
+
+	using traits = std::allocator_traits<alloc>;
+	using index_alloc = typename traits::template rebind_alloc<T*>;
+public:
+	using allocator_type = alloc;
+	using iterator = segmented_vector_it<T, ChunkSize>;
+	using const_iterator = segmented_vector_it<const T, ChunkSize>;
+
+	static constexpr std::size_t chunk_size = ChunkSize;
+public:
+	segmented_vector() = default;
+	explicit segmented_vector(const alloc& a): alloc_(a), chunks_(index_alloc(a)) {}
+	// 원소 생성 중 예외가 발생해도 소멸자가 청크를 해제하도록, 할당자 생성자에 위임한다.
+	segmented_vector(const segmented_vector& o): segmented_vector(traits::select_on_container_copy_construction(o.alloc_)) {
+		copy_from(o);
+	}
+	segmented_vector(segmented_vector&& o) noexcept:
+		alloc_(std::move(o.alloc_)), chunks_(std::move(o.chunks_)), size_(std::exchange(o.size_, 0)) {}
+	segmented_vector& operator=(const segmented_vector& o) {
+		if (this == &o) {
+			return *this;
+		}
+		if constexpr (traits::propagate_on_container_copy_assignment::value) {
+			if (alloc_ != o.alloc_) {
+				release();
+				chunks_ = index_vector(index_alloc(o.alloc_));
+			}
+			alloc_ = o.alloc_;
+		}
+		clear();
+		copy_from(o);
+		return *this;
+	}
+	segmented_vector& operator=(segmented_vector&& o) noexcept(traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value) {
+		if (this == &o) {
+			return *this;
+		}
+		if constexpr (traits::propagate_on_container_move_assignment::value) {
+			release();
+			alloc_ = std::move(o.alloc_);
+			chunks_ = std::move(o.chunks_);
+			size_ = std::exchange(o.size_, 0);
+		} else if (alloc_ == o.alloc_) {
+			release();
+			chunks_ = std::move(o.chunks_);
+			size_ = std::exchange(o.size_, 0);
+		} else {
+			// 청크를 넘겨받을 수 없으므로 원소 단위로 이동한다.
+			clear();
+			for (auto& e: o)
+				emplace_back(std::move(e));
+			o.clear();
+		}
+		return *this;
+	}
+	~segmented_vector() {
+		release();
+	}
+public:
+	segmented_vector(std::size_t size, const T& val, const alloc& a=alloc()): segmented_vector(a) {
+		reserve(size);
+		for (std::size_t c = 0; c * ChunkSize < size; ++c) {
+			const std::size_t n = size - c * ChunkSize < ChunkSize ? size - c * ChunkSize : ChunkSize;
+			construct_fill_n(alloc_, chunks_[c], n, val);
+			size_ += n;
+		}
+	}
+public:
+	alloc get_allocator() const {
+		return alloc_;
+	}
+	void swap(segmented_vector& o) noexcept {
+		if constexpr (traits::propagate_on_container_swap::value) {
+			using std::swap;
+			swap(alloc_, o.alloc_);
+		}
+		chunks_.swap(o.chunks_);
+		std::swap(size_, o.size_);
+	}
+public:
+	std::size_t size() const {
+		return size_;
+	}
+	bool empty() const {
+		return size_ == 0;
+	}
+	/// @brief 새 청크를 할당하지 않고 담을 수 있는 원소 수
+	std::size_t capacity() const {
+		return chunks_.size() * ChunkSize;
+	}
+	std::size_t chunk_count() const {
+		return chunks_.size();
+	}
+	/// @brief \p cap 개 이상을 담을 수 있도록 청크를 미리 할당한다.
+	void reserve(std::size_t cap) {
+		const std::size_t need = (cap + mask) >> shift;
+		chunks_.reserve(need);
+		while (chunks_.size() < need) {
+			add_chunk();
+		}
+	}
+	/// @brief 원소가 없는 청크를 모두 반환한다.
+	void shrink_to_fit() {
+		const std::size_t used = (size_ + mask) >> shift;
+		while (chunks_.size() > used) {
+			traits::deallocate(alloc_, chunks_.back(), ChunkSize);
+			chunks_.pop_back();
+		}
+	}
+public: // 접근
+	const T& operator[](std::size_t i) const {
+		return chunks_[i >> shift][i & mask];
+	}
+	T& operator[](std::size_t i) {
+		return const_cast<T&>(static_cast<const segmented_vector&>(*this)[i]);
+	}
+	const T& front() const {
+		return (*this)[0];
+	}
+	T& front() {
+		return (*this)[0];
+	}
+	const T& back() const {
+		return (*this)[size_ - 1];
+	}
+	T& back() {
+		return (*this)[size_ - 1];
+	}
+public: // 수정
+	void push_back(const T& v) {
+		emplace_back(v);
+	}
+	void push_back(T&& v) {
+		emplace_back(std::move(v));
+	}
+	/// @brief 맨 뒤에 원소를 생성한다.
+	/// @details 기존 원소는 옮겨지지 않으므로, 인자가 이 컨테이너의 원소를 참조해도 안전하다.
+	/// 최악의 경우에도 청크 하나의 할당과 청크 목록의 성장(포인터 복사)만 일어난다.
+	template <class... Args>
+	T& emplace_back(Args&&... args) {
+		if (size_ == capacity()) {
+			add_chunk();
+		}
+		T* p = chunks_[size_ >> shift] + (size_ & mask);
+		traits::construct(alloc_, p, std::forward<Args>(args)...);
+		++size_;
+		return *p;
+	}
+	void pop_back() {
+		--size_;
+		traits::destroy(alloc_, chunks_[size_ >> shift] + (size_ & mask));
+	}
+	/// @brief 모든 원소를 소멸시킨다. 청크는 재사용을 위해 남겨둔다.
+	void clear() {
+		for (std::size_t c = 0; c * ChunkSize < size_; ++c) {
+			const std::size_t n = size_ - c * ChunkSize < ChunkSize ? size_ - c * ChunkSize : ChunkSize;
+			destroy_n(alloc_, chunks_[c], n);
+		}
+		size_ = 0;
+	}
+public: // 반복자
+	iterator begin() {
+		return iterator(chunks_.data(), 0);
+	}
+	iterator end() {
+		return iterator(chunks_.data(), size_);
+	}
+	const_iterator begin() const {
+		return const_iterator(chunks_.data(), 0);
+	}
+	const_iterator end() const {
+		return const_iterator(chunks_.data(), size_);
+	}
+	const_iterator cbegin() const {
+		return begin();
+	}
+	const_iterator cend() const {
+		return end();
+	}
+private:
+	using index_vector = vector<T*, index_alloc>;
+
+	void add_chunk() {
+		T* c = traits::allocate(alloc_, ChunkSize);
+		try {
+			chunks_.push_back(c);
+		} catch (...) {
+			traits::deallocate(alloc_, c, ChunkSize);
+			throw;
+		}
+	}
+	void release() {
+		clear();
+		for (T* c: chunks_) {
+			traits::deallocate(alloc_, c, ChunkSize);
+		}
+		chunks_.clear();
+	}
+	/// @brief \p o 의 원소들을 복사한다. 이 컨테이너는 비어있어야 한다.
+	void copy_from(const segmented_vector& o) {
+		reserve(o.size_);
+		for (std::size_t c = 0; c * ChunkSize < o.size_; ++c) {
+			const std::size_t n = o.size_ - c * ChunkSize < ChunkSize ? o.size_ - c * ChunkSize : ChunkSize;
+			construct_copy_n(alloc_, o.chunks_[c], n, chunks_[c]);
+			size_ += n;
+		}
+	}
+
+private:
+	[[no_unique_address]] alloc alloc_;
+	index_vector chunks_;
+	std::size_t size_ = 0;
+}; // class segmented_vector
+
+} // namespace rds
@@ -0,0 +1,459 @@
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "allocator.h"
+#include "vector.h"
+#include "Old/TypeList.hpp"
+
+namespace rds {
+
+template <class List, class alloc=allocator<std::byte>>
+class soa_vector;
+
+/// @brief \ref soa_vector 의 행 프록시. 한 행의 필드들을 참조하는 `std::tuple<Ts&...>` 이다.
+/// @details 행 프록시 자체는 임시 값이므로, 대입과 \ref swap 은 프록시가 아니라 참조하는 필드들에 적용된다.
+/// 행끼리 대입하면 필드를 복사하고, `std::tuple<Ts...>` 를 우측값으로 대입하면 필드를 이동한다.
+/// 따라서 `std::sort` 처럼 `swap(*a, *b)` 와 임시 값을 사용하는 알고리즘에 행 반복자를 넘길 수 있다.
+template <class... Ts>
+class soa_row: public std::tuple<Ts&...> {
+	using base = std::tuple<Ts&...>;
+public:
+	using base::base;
+	soa_row(const soa_row&) = default;
+	using base::operator=;
+	soa_row& operator=(const soa_row& o) {
+		base::operator=(o);
+		return *this;
+	}
+	friend void swap(soa_row l, soa_row r) {
+		swap_fields(l, r, std::index_sequence_for<Ts...>{});
+	}
+private:
+	template <std::size_t... I>
+	static void swap_fields(soa_row& l, soa_row& r, std::index_sequence<I...>) {
+		using std::swap;
+		(swap(std::get<I>(l), std::get<I>(r)), ...);
+	}
+}; // class soa_row
+
+/// @brief 필드마다 별도의 연속된 열(column)에 저장하는 동적 배열 템플릿 클래스 (structure of arrays)
+/// @tparam Ts 한 행을 이루는 필드들의 형식. `soa_vector<TypeList<A, B, C>>` 처럼 \ref TypeList 로 넘긴다.
+/// @tparam alloc 열의 할당에 사용할 할당자. 열마다 필드 형식으로 rebind 해서 사용한다.
+/// @details 모든 열은 크기와 용량을 공유하며, \p i 번 행은 각 열의 \p i 번 원소들로 이루어진다.
+/// 한 필드만 다루는 반복문은 \ref column 으로 그 열만 순회하므로, 다른 필드가 캐시 라인을 차지하지 않는다.
+/// 행 단위로 접근할 때는 필드들의 참조를 묶은 `std::tuple` 인 \ref soa_row 를 행 프록시로 사용하며,
+/// \ref begin, \ref end 는 행 프록시를 반환하는 임의 접근 반복자다.
+/// @code
+/// std::sort(v.begin(), v.end(), [](const auto& l, const auto& r) { return std::get<1>(l) < std::get<1>(r); });
+/// @endcode
+/// @code
+/// rds::soa_vector<rds::TypeList<float, int>> v;
+/// v.emplace_back(1.0f, 2);
+/// auto [f, i] = v[0];  // float&, int&
+/// for (float& x: v.column<0>()) x *= 2;
+/// @endcode
+template <class... Ts, class alloc>
+class soa_vector<TypeList<Ts...>, alloc> {
+	static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one field");
+
+	using traits = std::allocator_traits<alloc>;
+	template <class T>
+	using column_alloc = typename traits::template rebind_alloc<T>;
+	template <class T>
+	using column_traits = std::allocator_traits<column_alloc<T>>;
+	using indices = std::index_sequence_for<Ts...>;
+
+	/// @brief 재배치 중에 예외를 던질 수 없는 필드인지 여부
+	template <class T>
+	static constexpr bool nothrow_relocatable = is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+public:
+	using allocator_type = alloc;
+	using fields = TypeList<Ts...>;
+	/// @brief \p I 번 필드의 형식
+	template <std::size_t I>
+	using column_type = Get<fields, I>;
+	/// @brief 행 프록시. 한 행의 필드들을 참조한다.
+	using reference = soa_row<Ts...>;
+	using const_reference = soa_row<const Ts...>;
+	using value_type = std::tuple<Ts...>;
+
+	static constexpr std::size_t column_count = sizeof...(Ts);
+public:
+	soa_vector() = default;
+	explicit soa_vector(const alloc& a): alloc_(a) {}
+	// 원소 생성 중 예외가 발생해도 소멸자가 열을 해제하도록, 할당자 생성자에 위임한다.
+	soa_vector(const soa_vector& o): soa_vector(traits::select_on_container_copy_construction(o.alloc_)) {
+		copy_from(o);
+	}
+	soa_vector(soa_vector&& o) noexcept: alloc_(std::move(o.alloc_)) {
+		steal(o);
+	}
+	soa_vector& operator=(const soa_vector& o) {
+		if (this == &o) {
+			return *this;
+		}
+		if constexpr (traits::propagate_on_container_copy_assignment::value) {
+			if (alloc_ != o.alloc_) {
+				release();
+			}
+			alloc_ = o.alloc_;
+		}
+		clear();
+		copy_from(o);
+		return *this;
+	}
+	soa_vector& operator=(soa_vector&& o) noexcept(traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value) {
+		if (this == &o) {
+			return *this;
+		}
+		if constexpr (traits::propagate_on_container_move_assignment::value) {
+			release();
+			alloc_ = std::move(o.alloc_);
+			steal(o);
+		} else if (alloc_ == o.alloc_) {
+			release();
+			steal(o);
+		} else {
+			// 열을 넘겨받을 수 없으므로 행 단위로 이동한다.
+			clear();
+			reserve(o.size_);
+			for (std::size_t i = 0; i < o.size_; ++i) {
+				std::apply([this](auto&... f) { emplace_back(std::move(f)...); }, o[i]);
+			}
+			o.clear();
+		}
+		return *this;
+	}
+	~soa_vector() {
+		release();
+	}
+public:
+	explicit soa_vector(std::size_t size, const alloc& a=alloc()): soa_vector(a) {
+		resize(size);
+	}
+public:
+	alloc get_allocator() const {
+		return alloc_;
+	}
+	void swap(soa_vector& o) noexcept {
+		if constexpr (traits::propagate_on_container_swap::value) {
+			using std::swap;
+			swap(alloc_, o.alloc_);
+		}
+		columns_.swap(o.columns_);
+		std::swap(size_, o.size_);
+		std::swap(capacity_, o.capacity_);
+	}
+public:
+	std::size_t size() const {
+		return size_;
+	}
+	std::size_t capacity() const {
+		return capacity_;
+	}
+	bool empty() const {
+		return size_ == 0;
+	}
+	/// @brief 모든 열의 용량을 \p cap 이상으로 늘린다.
+	/// @details 예외를 던질 수 있는 필드의 열을 먼저 복사하고 나머지는 예외 없이 옮기므로,
+	/// 예외가 발생하면 컨테이너는 호출 전 상태로 남는다.
+	void reserve(std::size_t cap) {
+		if (cap <= capacity_) {
+			return;
+		}
+		reallocate(cap, indices{});
+	}
+public: // 접근
+	reference operator[](std::size_t i) {
+		return row(i, indices{});
+	}
+	const_reference operator[](std::size_t i) const {
+		return row(i, indices{});
+	}
+	reference front() {
+		return (*this)[0];
+	}
+	const_reference front() const {
+		return (*this)[0];
+	}
+	reference back() {
+		return (*this)[size_ - 1];
+	}
+	const_reference back() const {
+		return (*this)[size_ - 1];
+	}
+	/// @brief \p I 번 필드의 열 전체
+	template <std::size_t I>
+	std::span<column_type<I>> column() {
+		return {std::get<I>(columns_), size_};
+	}
+	template <std::size_t I>
+	std::span<const column_type<I>> column() const {
+		return {std::get<I>(columns_), size_};
+	}
+	template <std::size_t I>
+	column_type<I>* data() {
+		return std::get<I>(columns_);
+	}
+	template <std::size_t I>
+	const column_type<I>* data() const {
+		return std::get<I>(columns_);
+	}
+public: // 반복자
+	/// @brief 행 단위 임의 접근 반복자. 역참조하면 행 프록시를 반환한다.
+	/// @note 역참조 결과가 프록시이므로 `std::random_access_iterator` 개념은 만족하지 않는다. (`std::ranges` 알고리즘 대신 `std::` 알고리즘을 사용한다)
+	template <bool Const>
+	class row_iterator {
+		using container = std::conditional_t<Const, const soa_vector, soa_vector>;
+	public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = soa_vector::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = std::conditional_t<Const, soa_vector::const_reference, soa_vector::reference>;
+	public:
+		row_iterator() = default;
+		row_iterator(container* v, std::size_t i): v_(v), i_(i) {}
+		template <bool C>
+		requires (Const && !C)
+		row_iterator(const row_iterator<C>& o): v_(o.v_), i_(o.i_) {}
+	public:
+		reference operator*() const {
+			return (*v_)[i_];
+		}
+		reference operator[](difference_type diff) const {
+			return (*v_)[i_ + diff];
+		}
+	public:
+		auto operator<=>(const row_iterator& o) const {
+			return i_ <=> o.i_;
+		}
+		bool operator==(const row_iterator& o) const {
+			return i_ == o.i_;
+		}
+	public:
+		row_iterator& operator+=(difference_type diff) {
+			i_ += diff;
+			return *this;
+		}
+		row_iterator& operator-=(difference_type diff) {
+			i_ -= diff;
+			return *this;
+		}
+		row_iterator& operator++() {
+			++i_;
+			return *this;
+		}
+		row_iterator& operator--() {
+			--i_;
+			return *this;
+		}
+		row_iterator operator++(int) {
+			auto t(*this);
+			++i_;
+			return t;
+		}
+		row_iterator operator--(int) {
+			auto t(*this);
+			--i_;
+			return t;
+		}
+		row_iterator operator+(difference_type diff) const {
+			return row_iterator(v_, i_ + diff);
+		}
+		row_iterator operator-(difference_type diff) const {
+			return row_iterator(v_, i_ - diff);
+		}
+		difference_type operator-(const row_iterator& o) const {
+			return static_cast<difference_type>(i_ - o.i_);
+		}
+		friend row_iterator operator+(difference_type diff, const row_iterator& it) {
+			return it + diff;
+		}
+	private:
+		friend class row_iterator<true>;
+		container* v_ = nullptr;
+		std::size_t i_ = 0;
+	}; // class row_iterator
+	using iterator = row_iterator<false>;
+	using const_iterator = row_iterator<true>;
+
+	iterator begin() {
+		return iterator(this, 0);
+	}
+	iterator end() {
+		return iterator(this, size_);
+	}
+	const_iterator begin() const {
+		return const_iterator(this, 0);
+	}
+	const_iterator end() const {
+		return const_iterator(this, size_);
+	}
+	const_iterator cbegin() const {
+		return begin();
+	}
+	const_iterator cend() const {
+		return end();
+	}
+public: // 수정
+	void push_back(const Ts&... fields) {
+		emplace_back(fields...);
+	}
+	/// @brief 맨 뒤에 행을 추가한다. 필드마다 인자 하나로 생성한다.
+	template <class... Us>
+	requires (sizeof...(Us) == sizeof...(Ts))
+	reference emplace_back(Us&&... args) {
+		if (size_ == capacity_) {
+			// 인자가 이 컨테이너의 원소를 참조할 수 있으므로, 재할당 전에 먼저 생성한다.
+			value_type t(std::forward<Us>(args)...);
+			reserve(growth_x2::next(capacity_));
+			std::apply([this](Ts&... f) { construct_row(size_, indices{}, std::move(f)...); }, t);
+		} else {
+			construct_row(size_, indices{}, std::forward<Us>(args)...);
+		}
+		return (*this)[size_++];
+	}
+	void pop_back() {
+		--size_;
+		for_each_column([this](auto* c) { destroy_n(alloc_, c + size_, 1); });
+	}
+	/// @brief 크기를 \p n 으로 바꾼다. 늘어난 행의 필드들은 값 초기화한다.
+	void resize(std::size_t n) {
+		if (n <= size_) {
+			for_each_column([this, n](auto* c) { destroy_n(alloc_, c + n, size_ - n); });
+			size_ = n;
+			return;
+		}
+		reserve(n);
+		construct_rows(n - size_, indices{});
+		size_ = n;
+	}
+	void clear() {
+		for_each_column([this](auto* c) { destroy_n(alloc_, c, size_); });
+		size_ = 0;
+	}
+private:
+	template <std::size_t... I>
+	reference row(std::size_t i, std::index_sequence<I...>) {
+		return reference(std::get<I>(columns_)[i]...);
+	}
+	template <std::size_t... I>
+	const_reference row(std::size_t i, std::index_sequence<I...>) const {
+		return const_reference(std::get<I>(columns_)[i]...);
+	}
+
+	/// @brief \p i 번 행의 필드들을 생성한다. 한 필드라도 실패하면 앞서 생성한 필드들을 소멸시킨다.
+	template <std::size_t... I, class... Us>
+	void construct_row(std::size_t i, std::index_sequence<I...>, Us&&... args) {
+		std::size_t done = 0;
+		try {
+			((traits::construct(alloc_, std::get<I>(columns_) + i, std::forward<Us>(args)), ++done), ...);
+		} catch (...) {
+			((I < done ? destroy_n(alloc_, std::get<I>(columns_) + i, 1) : void()), ...);
+			throw;
+		}
+	}
+	/// @brief 맨 뒤에 값 초기화한 \p n 개의 행을 생성한다.
+	template <std::size_t... I>
+	void construct_rows(std::size_t n, std::index_sequence<I...>) {
+		std::size_t done = 0;
+		try {
+			((construct_n(alloc_, std::get<I>(columns_) + size_, n), ++done), ...);
+		} catch (...) {
+			((I < done ? destroy_n(alloc_, std::get<I>(columns_) + size_, n) : void()), ...);
+			throw;
+		}
+	}
+
+	template <std::size_t... I>
+	void reallocate(std::size_t cap, std::index_sequence<I...>) {
+		std::tuple<Ts*...> next{};
+		std::size_t allocated = 0;
+		std::size_t copied = 0;
+		try {
+			((std::get<I>(next) = allocate_column<Ts>(cap), ++allocated), ...);
+			// 예외를 던질 수 있는 열을 먼저 복사한다. 원본은 그대로 남는다.
+			((nothrow_relocatable<Ts> ? void() : construct_copy_n(alloc_, std::get<I>(columns_), size_, std::get<I>(next)), ++copied), ...);
+		} catch (...) {
+			((I < copied && !nothrow_relocatable<Ts> ? destroy_n(alloc_, std::get<I>(next), size_) : void()), ...);
+			((I < allocated ? deallocate_column(std::get<I>(next), cap) : void()), ...);
+			throw;
+		}
+		// 나머지 열은 예외 없이 옮긴다.
+		((nothrow_relocatable<Ts> ? relocate(alloc_, std::get<I>(columns_), size_, std::get<I>(next)) : destroy_n(alloc_, std::get<I>(columns_), size_)), ...);
+		if (capacity_ != 0) {
+			for_each_column([this](auto* c) { deallocate_column(c, capacity_); });
+		}
+		columns_ = next;
+		capacity_ = cap;
+	}
+
+	template <class T>
+	T* allocate_column(std::size_t n) {
+		column_alloc<T> a(alloc_);
+		return column_traits<T>::allocate(a, n);
+	}
+	template <class T>
+	void deallocate_column(T* p, std::size_t n) {
+		column_alloc<T> a(alloc_);
+		column_traits<T>::deallocate(a, p, n);
+	}
+	/// @brief 열마다 \p f(첫 원소의 포인터) 를 호출한다.
+	template <class F>
+	void for_each_column(F&& f) {
+		std::apply([&f](auto*... c) { (f(c), ...); }, columns_);
+	}
+	/// @brief 모든 행을 소멸시키고 메모리를 해제한다.
+	void release() {
+		clear();
+		if (capacity_ != 0) {
+			for_each_column([this](auto* c) { deallocate_column(c, capacity_); });
+		}
+		columns_ = {};
+		capacity_ = 0;
+	}
+	/// @brief \p o 의 행들을 복사한다. 이 컨테이너는 비어있어야 한다.
+	void copy_from(const soa_vector& o) {
+		reserve(o.size_);
+		copy_columns(o, indices{});
+		size_ = o.size_;
+	}
+	template <std::size_t... I>
+	void copy_columns(const soa_vector& o, std::index_sequence<I...>) {
+		std::size_t done = 0;
+		try {
+			((construct_copy_n(alloc_, std::get<I>(o.columns_), o.size_, std::get<I>(columns_)), ++done), ...);
+		} catch (...) {
+			((I < done ? destroy_n(alloc_, std::get<I>(columns_), o.size_) : void()), ...);
+			throw;
+		}
+	}
+	/// @brief \p o 의 열들을 넘겨받는다. 이 컨테이너는 비어있어야 한다.
+	void steal(soa_vector& o) {
+		columns_ = std::exchange(o.columns_, {});
+		size_ = std::exchange(o.size_, 0);
+		capacity_ = std::exchange(o.capacity_, 0);
+	}
+
+private:
+	[[no_unique_address]] alloc alloc_;
+	std::size_t size_ = 0;
+	std::size_t capacity_ = 0;
+	std::tuple<Ts*...> columns_{};
+}; // class soa_vector
+
+} // namespace rds
+
+template <class... Ts>
+struct std::tuple_size<rds::soa_row<Ts...>>: std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <std::size_t I, class... Ts>
+struct std::tuple_element<I, rds::soa_row<Ts...>>: std::tuple_element<I, std::tuple<Ts&...>> {};
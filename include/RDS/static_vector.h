@@ -0,0 +1,231 @@
+#pragma once
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "vector.h"
+
+namespace rds {
+
+/// @brief 컴파일 타임에 정해진 용량 \p N 을 객체 내부에 가지는, 힙을 전혀 사용하지 않는 동적 배열 템플릿 클래스
+/// @details \ref array 처럼 원소를 객체 안에 저장하지만, 크기는 런타임에 바뀌며 사용하지 않는 칸은
+/// 초기화되지 않은 상태로 남는다. 할당자가 없으므로 시그널 핸들러나 지연 시간에 민감한 경로에서도
+/// 사용할 수 있다. `T` 가 trivially destructible 하면 `constexpr` 문맥에서도 사용할 수 있다.
+/// @note 용량을 넘어서 추가하면 `emplace_back`/`push_back` 은 `std::bad_alloc` 을 던지고,
+/// `try_emplace_back`/`try_push_back` 은 `nullptr` 를 반환한다.
+template <class T, std::size_t N>
+class static_vector {
+public:
+	constexpr static_vector() {}
+	// 생성 중 예외가 발생하면 소멸자가 이미 생성한 원소들을 소멸시키도록, 기본 생성자에 위임한다.
+	constexpr static_vector(const static_vector& o): static_vector() {
+		for (; size_ < o.size_; ++size_) {
+			std::construct_at(data_ + size_, o.data_[size_]);
+		}
+	}
+	constexpr static_vector(static_vector&& o) noexcept(std::is_nothrow_move_constructible_v<T>): static_vector() {
+		for (; size_ < o.size_; ++size_) {
+			std::construct_at(data_ + size_, std::move(o.data_[size_]));
+		}
+		o.clear();
+	}
+	constexpr static_vector& operator=(const static_vector& o) {
+		if (this != &o) {
+			clear();
+			for (; size_ < o.size_; ++size_) {
+				std::construct_at(data_ + size_, o.data_[size_]);
+			}
+		}
+		return *this;
+	}
+	constexpr static_vector& operator=(static_vector&& o) noexcept(std::is_nothrow_move_constructible_v<T>) {
+		if (this != &o) {
+			clear();
+			for (; size_ < o.size_; ++size_) {
+				std::construct_at(data_ + size_, std::move(o.data_[size_]));
+			}
+			o.clear();
+		}
+		return *this;
+	}
+	constexpr ~static_vector() requires std::is_trivially_destructible_v<T> = default;
+	constexpr ~static_vector() {
+		clear();
+	}
+public:
+	constexpr static_vector(std::size_t size): static_vector() {
+		check(size);
+		for (; size_ < size; ++size_) {
+			std::construct_at(data_ + size_);
+		}
+	}
+	constexpr static_vector(std::size_t size, const T& val): static_vector() {
+		check(size);
+		for (; size_ < size; ++size_) {
+			std::construct_at(data_ + size_, val);
+		}
+	}
+	constexpr static_vector(const std::initializer_list<T>& il): static_vector() {
+		check(il.size());
+		for (const auto& e: il) {
+			std::construct_at(data_ + size_++, e);
+		}
+	}
+public: // 용량
+	constexpr std::size_t size() const {
+		return size_;
+	}
+	static constexpr std::size_t capacity() {
+		return N;
+	}
+	static constexpr std::size_t max_size() {
+		return N;
+	}
+	constexpr bool empty() const {
+		return size_ == 0;
+	}
+	constexpr bool full() const {
+		return size_ == N;
+	}
+public: // 접근
+	constexpr const T& operator[](std::size_t i) const {
+		return data_[i];
+	}
+	constexpr T& operator[](std::size_t i) {
+		return data_[i];
+	}
+	constexpr const T& front() const {
+		return data_[0];
+	}
+	constexpr T& front() {
+		return data_[0];
+	}
+	constexpr const T& back() const {
+		return data_[size_ - 1];
+	}
+	constexpr T& back() {
+		return data_[size_ - 1];
+	}
+	constexpr const T* data() const {
+		return data_;
+	}
+	constexpr T* data() {
+		return data_;
+	}
+public: // 수정
+	constexpr void push_back(const T& v) {
+		emplace_back(v);
+	}
+	constexpr void push_back(T&& v) {
+		emplace_back(std::move(v));
+	}
+	template <class... Args>
+	constexpr T& emplace_back(Args&&... args) {
+		check(size_ + 1);
+		return *std::construct_at(data_ + size_++, std::forward<Args>(args)...);
+	}
+	constexpr T* try_push_back(const T& v) {
+		return try_emplace_back(v);
+	}
+	constexpr T* try_push_back(T&& v) {
+		return try_emplace_back(std::move(v));
+	}
+	/// @brief 용량이 남아있으면 맨 뒤에 원소를 생성하고 그 주소를, 가득 찼으면 `nullptr` 를 반환
+	template <class... Args>
+	constexpr T* try_emplace_back(Args&&... args) {
+		if (size_ == N) {
+			return nullptr;
+		}
+		return std::construct_at(data_ + size_++, std::forward<Args>(args)...);
+	}
+	constexpr void pop_back() {
+		std::destroy_at(data_ + --size_);
+	}
+	constexpr void clear() {
+		for (std::size_t i = 0; i < size_; ++i) {
+			std::destroy_at(data_ + i);
+		}
+		size_ = 0;
+	}
+public: // 반복자
+	using iterator = vector_it<T>;
+	using const_iterator = vector_it<const T>;
+
+	constexpr iterator begin() {
+		return iterator(data_, 0);
+	}
+	constexpr iterator end() {
+		return iterator(data_, size_);
+	}
+	constexpr const_iterator begin() const {
+		return const_iterator(data_, 0);
+	}
+	constexpr const_iterator end() const {
+		return const_iterator(data_, size_);
+	}
+	constexpr const_iterator cbegin() const {
+		return begin();
+	}
+	constexpr const_iterator cend() const {
+		return end();
+	}
+private:
+	constexpr static void check(std::size_t size) {
+		if (size > N) {
+			throw std::bad_alloc();
+		}
+	}
+
+private:
+	// 공용체로 감싸서 원소를 생성하지 않은 채로 저장소만 잡아둔다.
+	union {
+		T data_[N];
+	};
+	std::size_t size_ = 0;
+}; // class static_vector
+
+/// @brief 크기 0인 특수화
+template <class T>
+class static_vector<T, 0> {
+public:
+	constexpr std::size_t size() const {
+		return 0;
+	}
+	static constexpr std::size_t capacity() {
+		return 0;
+	}
+	static constexpr std::size_t max_size() {
+		return 0;
+	}
+	constexpr bool empty() const {
+		return true;
+	}
+	constexpr bool full() const {
+		return true;
+	}
+	template <class... Args>
+	constexpr T* try_emplace_back(Args&&...) {
+		return nullptr;
+	}
+public:
+	using iterator = vector_it<T>;
+	using const_iterator = vector_it<const T>;
+
+	constexpr iterator begin() {
+		return iterator();
+	}
+	constexpr iterator end() {
+		return iterator();
+	}
+	constexpr const_iterator begin() const {
+		return const_iterator();
+	}
+	constexpr const_iterator end() const {
+		return const_iterator();
+	}
+}; // class static_vector<T, 0>
+
+}; // namespace rds
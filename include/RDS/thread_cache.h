@@ -0,0 +1,239 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rds {
+
+/// @brief 스레드별 캐시를 가지는 크기 등급(size class) 메모리 할당기
+/// @details
+/// - 요청 크기는 크기 등급으로 올림된다. (256 바이트까지 16 바이트 간격, 1024 바이트까지 64 바이트 간격)
+/// - 각 스레드는 크기 등급마다 자유 리스트를 가지며, 대부분의 할당/해제는 잠금 없이 여기서 끝난다.
+/// - 스레드 캐시가 비면 공유 중앙 리스트에서 한 묶음(batch)을 받아오고, 너무 많이 쌓이면 한 묶음을 돌려준다.
+///   중앙 리스트는 크기 등급마다 따로 잠근다.
+/// - 중앙 리스트가 비면 64KiB 스팬을 `::operator new` 로 받아와 잘게 나눈다. 스팬은 운영체제에 반환하지 않는다.
+/// - 1024 바이트보다 크거나 16 바이트보다 큰 정렬이 필요한 요청은 `::operator new` 로 넘긴다.
+///
+/// 해제 시에는 할당할 때와 같은 크기를 넘겨주어야 한다.
+/// 스레드 캐시가 이미 소멸한 종료 시점(정적/스레드 지역 컨테이너의 소멸자 등)에는 중앙 리스트를 직접 사용한다.
+class thread_cache {
+public:
+	static constexpr std::size_t max_small_size = 1024;
+	static constexpr std::size_t alignment = 16;
+	static constexpr std::size_t class_count = 256 / 16 + (1024 - 256) / 64;
+	static constexpr std::size_t span_size = 64 * 1024;
+public:
+	/// @brief \p bytes 를 담을 수 있는 가장 작은 크기 등급의 번호를 반환
+	static constexpr std::size_t class_index(std::size_t bytes) {
+		if (bytes <= 256) {
+			return bytes == 0 ? 0 : (bytes - 1) / 16;
+		}
+		return 256 / 16 + (bytes - 256 - 1) / 64;
+	}
+	/// @brief \p idx 번 크기 등급의 크기를 반환
+	static constexpr std::size_t class_size(std::size_t idx) {
+		if (idx < 256 / 16) {
+			return (idx + 1) * 16;
+		}
+		return 256 + (idx - 256 / 16 + 1) * 64;
+	}
+	/// @brief \p idx 번 크기 등급에서 중앙 리스트와 한 번에 주고받는 객체의 개수
+	static constexpr std::size_t batch_size(std::size_t idx) {
+		const std::size_t n = 4096 / class_size(idx);
+		return n < 4 ? 4 : (n > 64 ? 64 : n);
+	}
+public:
+	static void* allocate(std::size_t bytes, std::size_t align=alignof(std::max_align_t)) {
+		if (bytes > max_small_size || align > alignment) {
+			return ::operator new(bytes, std::align_val_t(align));
+		}
+		const std::size_t idx = class_index(bytes);
+		if (thread_cache* cache = local()) {
+			return cache->pop(idx);
+		}
+		std::size_t got;
+		return central()[idx].fetch(idx, 1, got);
+	}
+	static void deallocate(void* p, std::size_t bytes, std::size_t align=alignof(std::max_align_t)) {
+		if (p == nullptr) {
+			return;
+		}
+		if (bytes > max_small_size || align > alignment) {
+			::operator delete(p, bytes, std::align_val_t(align));
+			return;
+		}
+		const std::size_t idx = class_index(bytes);
+		if (thread_cache* cache = local()) {
+			cache->push(idx, p);
+			return;
+		}
+		auto* obj = static_cast<free_obj*>(p);
+		central()[idx].release(obj, obj);
+	}
+private:
+	struct free_obj {
+		free_obj* next;
+	};
+	/// @brief 크기 등급 하나의 중앙 자유 리스트
+	struct central_list {
+		std::mutex mutex;
+		free_obj* head = nullptr;
+
+		/// @brief 최대 \p n 개의 객체를 꺼내 연결 리스트로 반환하고, 꺼낸 개수를 \p got 에 기록
+		free_obj* fetch(std::size_t idx, std::size_t n, std::size_t& got) {
+			std::lock_guard<std::mutex> lock(mutex);
+			if (head == nullptr) {
+				carve(idx);
+			}
+			free_obj* first = head;
+			free_obj* last = head;
+			got = 1;
+			while (got < n && last->next) {
+				last = last->next;
+				++got;
+			}
+			head = last->next;
+			last->next = nullptr;
+			return first;
+		}
+		/// @brief \p first 부터 \p last 까지 연결된 객체들을 돌려받는다.
+		void release(free_obj* first, free_obj* last) {
+			std::lock_guard<std::mutex> lock(mutex);
+			last->next = head;
+			head = first;
+		}
+		/// @brief 새 스팬을 받아와 \p idx 번 크기 등급의 객체들로 나눈다.
+		void carve(std::size_t idx) {
+			const std::size_t size = class_size(idx);
+			auto* span = static_cast<std::byte*>(::operator new(span_size, std::align_val_t(alignment)));
+			const std::size_t n = span_size / size;
+			for (std::size_t i = n; i > 0; --i) {
+				auto* obj = reinterpret_cast<free_obj*>(span + (i - 1) * size);
+				obj->next = head;
+				head = obj;
+			}
+		}
+	};
+	/// @brief 프로세스 전체에서 공유하는 중앙 리스트들
+	/// @note 종료 시점에 다른 정적 객체가 아직 메모리를 쥐고 있을 수 있으므로 일부러 해제하지 않는다.
+	static std::array<central_list, class_count>& central() {
+		static auto* lists = new std::array<central_list, class_count>();
+		return *lists;
+	}
+	/// @brief 현재 스레드의 캐시. 스레드 종료 중 캐시가 이미 소멸했으면 nullptr 을 반환한다.
+	static thread_cache* local() {
+		if (torn_down) {
+			return nullptr;
+		}
+		thread_local thread_cache cache;
+		return &cache;
+	}
+private:
+	thread_cache() = default;
+	thread_cache(const thread_cache&) = delete;
+	thread_cache& operator=(const thread_cache&) = delete;
+	/// @brief 스레드가 끝나면 캐시에 남은 객체들을 모두 중앙 리스트로 돌려준다.
+	~thread_cache() {
+		torn_down = true;
+		for (std::size_t i = 0; i < class_count; ++i) {
+			if (lists_[i].head) {
+				free_obj* last = lists_[i].head;
+				while (last->next)
+					last = last->next;
+				central()[i].release(lists_[i].head, last);
+			}
+		}
+	}
+	void* pop(std::size_t idx) {
+		auto& l = lists_[idx];
+		if (l.head == nullptr) {
+			l.head = central()[idx].fetch(idx, batch_size(idx), l.count);
+		}
+		free_obj* obj = l.head;
+		l.head = obj->next;
+		--l.count;
+		return obj;
+	}
+	void push(std::size_t idx, void* p) {
+		auto& l = lists_[idx];
+		auto* obj = static_cast<free_obj*>(p);
+		obj->next = l.head;
+		l.head = obj;
+		if (++l.count >= 2 * batch_size(idx)) {
+			// 한 묶음을 중앙 리스트로 돌려준다.
+			free_obj* first = l.head;
+			free_obj* last = first;
+			for (std::size_t i = 1; i < batch_size(idx); ++i)
+				last = last->next;
+			l.head = last->next;
+			l.count -= batch_size(idx);
+			central()[idx].release(first, last);
+		}
+	}
+
+private:
+	struct local_list {
+		free_obj* head = nullptr;
+		std::size_t count = 0;
+	};
+	std::array<local_list, class_count> lists_{};
+	/// @brief 현재 스레드의 캐시가 소멸했는지 여부. 소멸자가 없으므로 스레드가 끝날 때까지 읽을 수 있다.
+	static inline thread_local bool torn_down = false;
+}; // class thread_cache
+
+/// @brief \ref thread_cache 에서 메모리를 받아오는 할당자
+/// @details \ref allocator 와 같은 인터페이스를 가지며 상태가 없으므로 모든 인스턴스가 같다.
+template <class T>
+class thread_cache_allocator {
+public:
+	using value_type = T;
+	using pointer = T*;
+	using size_type = std::size_t;
+	using propagate_on_container_move_assignment = std::true_type;
+	using is_always_equal = std::true_type;
+
+	thread_cache_allocator() = default;
+	template <class U>
+	thread_cache_allocator(const thread_cache_allocator<U>&) {}
+
+	size_type max_size() const {
+		return size_type(-1) / sizeof(T);
+	}
+
+	pointer allocate(size_type n) {
+		if (n > max_size()) {
+			throw std::bad_alloc();
+		}
+
+		return static_cast<pointer>(thread_cache::allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(pointer p, size_type n) {
+		thread_cache::deallocate(p, n * sizeof(T), alignof(T));
+	}
+
+	template <class U, class... Args>
+	void construct(U* p, Args&&... args) {
+		::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+	}
+
+	template <class U>
+	void destroy(U* p) {
+		p->~U();
+	}
+};
+
+template <class T, class U>
+bool operator==(const thread_cache_allocator<T>&, const thread_cache_allocator<U>&) {
+	return true;
+}
+
+template <class T, class U>
+bool operator!=(const thread_cache_allocator<T>&, const thread_cache_allocator<U>&) {
+	return false;
+}
+
+} // namespace rds
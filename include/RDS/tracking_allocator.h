@@ -0,0 +1,305 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "allocator.h"
+
+namespace rds {
+
+/// @brief 할당 통계의 스냅숏
+struct alloc_stats {
+	/// @brief 태그별 통계
+	struct tag_stats {
+		std::string name;
+		std::int64_t bytes_in_use = 0;
+		std::uint64_t allocations = 0;
+	};
+	static constexpr std::size_t histogram_size = 64;
+
+	std::int64_t bytes_in_use = 0;
+	std::int64_t peak_bytes = 0;
+	std::uint64_t allocations = 0;
+	std::uint64_t deallocations = 0;
+	/// @brief `size_histogram[i]` 는 크기가 [2^i, 2^(i+1)) 바이트인 할당의 횟수 (0 바이트는 0번 칸)
+	std::array<std::uint64_t, histogram_size> size_histogram{};
+	std::vector<tag_stats> tags;
+};
+
+/// @brief \ref tracking_allocator 들이 기록하는 할당 통계의 저장소
+/// @details
+/// 카운터는 스레드마다 따로 두고(쓰는 스레드는 하나뿐이므로 원자적 RMW 없이 relaxed 저장만 한다),
+/// \ref snapshot 을 호출할 때 모든 스레드의 카운터를 합산한다. 따라서 할당 경로에는 잠금도 공유
+/// 캐시 라인에 대한 쓰기도 없다. 다만 최대 사용량은 스레드 카운터만으로 알 수 없으므로, 스레드마다
+/// 사용량 변화를 모아두었다가 \ref flush_threshold 를 넘을 때만 전역 카운터에 반영한다.
+/// 따라서 최대 사용량은 (스레드 수 × \ref flush_threshold) 이내의 오차를 가진다.
+/// 스레드 카운터가 이미 소멸한 종료 시점(정적/스레드 지역 컨테이너의 소멸자 등)의 기록은 잠금을 잡고 전역 카운터에 바로 더한다.
+class alloc_tracker {
+public:
+	static constexpr std::size_t max_tags = 64;
+	static constexpr std::int64_t flush_threshold = 64 * 1024;
+public:
+	/// @brief 이름이 \p name 인 태그의 번호를 반환한다. 처음 보는 이름이면 새로 등록한다.
+	/// @details 태그가 \ref max_tags 개를 넘으면 0번 태그("untagged")를 반환한다.
+	/// 호출 지점마다 한 번만 호출해 두고 번호를 재사용하는 것을 권장한다.
+	static std::size_t tag(const char* name) {
+		auto& r = registry();
+		std::lock_guard<std::mutex> lock(r.mutex);
+		for (std::size_t i = 0; i < r.tag_count; ++i) {
+			if (r.tag_names[i] == name) {
+				return i;
+			}
+		}
+		if (r.tag_count == max_tags) {
+			return 0;
+		}
+		r.tag_names[r.tag_count] = name;
+		return r.tag_count++;
+	}
+	/// @brief 모든 스레드의 카운터를 합산한 스냅숏을 반환한다.
+	static alloc_stats snapshot() {
+		auto& r = registry();
+		std::lock_guard<std::mutex> lock(r.mutex);
+
+		alloc_stats s;
+		counters total;
+		total.add(r.retired);
+		for (auto* c: r.live) {
+			total.add(*c);
+		}
+
+		s.allocations = total.allocations.load(std::memory_order_relaxed);
+		s.deallocations = total.deallocations.load(std::memory_order_relaxed);
+		s.bytes_in_use = total.bytes_allocated.load(std::memory_order_relaxed) - total.bytes_freed.load(std::memory_order_relaxed);
+		for (std::size_t i = 0; i < alloc_stats::histogram_size; ++i) {
+			s.size_histogram[i] = total.histogram[i].load(std::memory_order_relaxed);
+		}
+		for (std::size_t i = 0; i < r.tag_count; ++i) {
+			s.tags.push_back({r.tag_names[i],
+				static_cast<std::int64_t>(total.tag_allocated[i].load(std::memory_order_relaxed) - total.tag_freed[i].load(std::memory_order_relaxed)),
+				total.tag_allocations[i].load(std::memory_order_relaxed)});
+		}
+
+		const std::int64_t peak = r.peak.load(std::memory_order_relaxed);
+		s.peak_bytes = peak > s.bytes_in_use ? peak : s.bytes_in_use;
+		return s;
+	}
+	/// @brief \p bytes 바이트의 할당을 \p tag 번 태그로 기록한다.
+	static void on_allocate(std::size_t bytes, std::size_t tag) {
+		const auto record = [&](counters& c) {
+			bump(c.allocations, 1);
+			bump(c.bytes_allocated, bytes);
+			bump(c.histogram[bucket(bytes)], 1);
+			bump(c.tag_allocated[tag], bytes);
+			bump(c.tag_allocations[tag], 1);
+		};
+		if (thread_state* s = local()) {
+			record(s->c);
+			s->account(static_cast<std::int64_t>(bytes));
+			return;
+		}
+		auto& r = registry();
+		std::lock_guard<std::mutex> lock(r.mutex);
+		record(r.retired);
+		publish(static_cast<std::int64_t>(bytes));
+	}
+	/// @brief \p bytes 바이트의 해제를 \p tag 번 태그로 기록한다.
+	static void on_deallocate(std::size_t bytes, std::size_t tag) {
+		const auto record = [&](counters& c) {
+			bump(c.deallocations, 1);
+			bump(c.bytes_freed, bytes);
+			bump(c.tag_freed[tag], bytes);
+		};
+		if (thread_state* s = local()) {
+			record(s->c);
+			s->account(-static_cast<std::int64_t>(bytes));
+			return;
+		}
+		auto& r = registry();
+		std::lock_guard<std::mutex> lock(r.mutex);
+		record(r.retired);
+		publish(-static_cast<std::int64_t>(bytes));
+	}
+private:
+	using counter = std::atomic<std::uint64_t>;
+	struct counters {
+		counter allocations{0};
+		counter deallocations{0};
+		counter bytes_allocated{0};
+		counter bytes_freed{0};
+		std::array<counter, alloc_stats::histogram_size> histogram{};
+		std::array<counter, max_tags> tag_allocated{};
+		std::array<counter, max_tags> tag_freed{};
+		std::array<counter, max_tags> tag_allocations{};
+
+		void add(const counters& o) {
+			auto sum = [](counter& l, const counter& r) {
+				l.store(l.load(std::memory_order_relaxed) + r.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			};
+			sum(allocations, o.allocations);
+			sum(deallocations, o.deallocations);
+			sum(bytes_allocated, o.bytes_allocated);
+			sum(bytes_freed, o.bytes_freed);
+			for (std::size_t i = 0; i < histogram.size(); ++i)
+				sum(histogram[i], o.histogram[i]);
+			for (std::size_t i = 0; i < max_tags; ++i) {
+				sum(tag_allocated[i], o.tag_allocated[i]);
+				sum(tag_freed[i], o.tag_freed[i]);
+				sum(tag_allocations[i], o.tag_allocations[i]);
+			}
+		}
+	};
+	struct registry_t {
+		std::mutex mutex;
+		std::vector<counters*> live;
+		counters retired;
+		std::array<std::string, max_tags> tag_names{"untagged"};
+		std::size_t tag_count = 1;
+		std::atomic<std::int64_t> in_use{0};
+		std::atomic<std::int64_t> peak{0};
+	};
+	/// @brief 스레드 하나의 카운터. 스레드가 끝나면 합계를 retired 에 넘기고 등록을 해제한다.
+	struct thread_state {
+		counters c;
+		std::int64_t pending = 0;
+
+		thread_state() {
+			auto& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			r.live.push_back(&c);
+		}
+		~thread_state() {
+			torn_down = true;
+			flush();
+			auto& r = registry();
+			std::lock_guard<std::mutex> lock(r.mutex);
+			r.retired.add(c);
+			std::erase(r.live, &c);
+		}
+		void account(std::int64_t delta) {
+			pending += delta;
+			if (pending >= flush_threshold || pending <= -flush_threshold) {
+				flush();
+			}
+		}
+		void flush() {
+			publish(std::exchange(pending, 0));
+		}
+	};
+	/// @note 종료 시점까지 다른 스레드가 기록할 수 있으므로 일부러 해제하지 않는다.
+	static registry_t& registry() {
+		static auto* r = new registry_t();
+		return *r;
+	}
+	/// @brief 현재 스레드의 카운터. 스레드 종료 중 카운터가 이미 소멸했으면 nullptr 을 반환한다.
+	static thread_state* local() {
+		if (torn_down) {
+			return nullptr;
+		}
+		thread_local thread_state state;
+		return &state;
+	}
+	/// @brief 사용량 변화 \p delta 를 전역 카운터에 반영하고 최대 사용량을 갱신한다.
+	static void publish(std::int64_t delta) {
+		auto& r = registry();
+		const std::int64_t now = r.in_use.fetch_add(delta, std::memory_order_relaxed) + delta;
+		std::int64_t peak = r.peak.load(std::memory_order_relaxed);
+		while (now > peak && !r.peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+	}
+	static void bump(counter& c, std::uint64_t v) {
+		c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+	}
+	static std::size_t bucket(std::size_t bytes) {
+		std::size_t b = 0;
+		while (bytes >>= 1)
+			++b;
+		return b;
+	}
+
+	/// @brief 현재 스레드의 카운터가 소멸했는지 여부. 소멸자가 없으므로 스레드가 끝날 때까지 읽을 수 있다.
+	static inline thread_local bool torn_down = false;
+}; // class alloc_tracker
+
+/// @brief 다른 할당자를 감싸서 할당 통계를 \ref alloc_tracker 에 기록하는 할당자
+/// @tparam Base 실제 할당을 수행할 할당자 (기본값은 \ref allocator)
+/// @details 태그를 지정해 생성하면 그 호출 지점의 사용량을 따로 집계한다.
+/// 태그가 다른 할당자끼리도 같은 메모리를 해제할 수 있으므로 `Base` 가 같으면 같은 할당자로 취급한다.
+/// @code
+/// static const auto tag = rds::alloc_tracker::tag("ingest");
+/// rds::vector<int, rds::tracking_allocator<int>> v{rds::tracking_allocator<int>(tag)};
+/// @endcode
+template <class T, class Base=allocator<T>>
+class tracking_allocator {
+	using base_traits = std::allocator_traits<Base>;
+public:
+	using value_type = T;
+	using pointer = T*;
+	using size_type = std::size_t;
+	using propagate_on_container_copy_assignment = typename base_traits::propagate_on_container_copy_assignment;
+	using propagate_on_container_move_assignment = typename base_traits::propagate_on_container_move_assignment;
+	using propagate_on_container_swap = typename base_traits::propagate_on_container_swap;
+	template <class U>
+	struct rebind {
+		using other = tracking_allocator<U, typename base_traits::template rebind_alloc<U>>;
+	};
+
+	tracking_allocator() = default;
+	explicit tracking_allocator(std::size_t tag, const Base& base=Base()): base_(base), tag_(tag) {}
+	template <class U, class B>
+	tracking_allocator(const tracking_allocator<U, B>& o): base_(o.base()), tag_(o.tag()) {}
+
+	size_type max_size() const {
+		return base_traits::max_size(base_);
+	}
+
+	pointer allocate(size_type n) {
+		pointer p = base_traits::allocate(base_, n);
+		alloc_tracker::on_allocate(n * sizeof(T), tag_);
+		return p;
+	}
+
+	void deallocate(pointer p, size_type n) {
+		alloc_tracker::on_deallocate(n * sizeof(T), tag_);
+		base_traits::deallocate(base_, p, n);
+	}
+
+	template <class U, class... Args>
+	void construct(U* p, Args&&... args) {
+		base_traits::construct(base_, p, std::forward<Args>(args)...);
+	}
+
+	template <class U>
+	void destroy(U* p) {
+		base_traits::destroy(base_, p);
+	}
+
+	const Base& base() const {
+		return base_;
+	}
+	std::size_t tag() const {
+		return tag_;
+	}
+private:
+	[[no_unique_address]] Base base_;
+	std::size_t tag_ = 0;
+}; // class tracking_allocator
+
+template <class T, class BT, class U, class BU>
+bool operator==(const tracking_allocator<T, BT>& l, const tracking_allocator<U, BU>& r) {
+	return l.base() == r.base();
+}
+
+template <class T, class BT, class U, class BU>
+bool operator!=(const tracking_allocator<T, BT>& l, const tracking_allocator<U, BU>& r) {
+	return !(l == r);
+}
+
+} // namespace rds
@@ -1,80 +1,109 @@
 #pragma once
 #include <numeric>
+#include <limits>
 #include <cstddef>
+#include <iterator>
+#include <utility>
+#include <cstring>
+#include <type_traits>
 
 #include "allocator.h"
 
 namespace rds {
 
+/// @brief 용량을 1.5배씩 늘리는 성장 정책
+struct growth_x1_5 {
+	static constexpr std::size_t next(std::size_t cap) {
+		return cap < 2 ? cap + 1 : cap + cap / 2;
+	}
+};
+
+/// @brief 용량을 2배씩 늘리는 성장 정책
+struct growth_x2 {
+	static constexpr std::size_t next(std::size_t cap) {
+		return cap == 0 ? 1 : cap * 2;
+	}
+};
+
 template <class T>
 class vector_it {
 public:
 	using iterator_category = std::random_access_iterator_tag;
+	using iterator_concept = std::contiguous_iterator_tag;
 	using value_type = T;
 	using difference_type = std::ptrdiff_t;
 	using pointer = value_type*;
 	using reference = value_type&;
 public:
-	vector_it(): ptr_(nullptr), off_(0) {}
-	vector_it(T* ptr, std::size_t off=0): ptr_(ptr), off_(off) {}
-	vector_it(const vector_it&) = default;
-	vector_it(vector_it&&) = default;
-	vector_it& operator=(const vector_it&) = default;
-	vector_it& operator=(T* ptr) {
+	constexpr vector_it(): ptr_(nullptr), off_(0) {}
+	constexpr vector_it(T* ptr, std::size_t off=0): ptr_(ptr), off_(off) {}
+	constexpr vector_it(const vector_it&) = default;
+	constexpr vector_it(vector_it&&) = default;
+	constexpr vector_it& operator=(const vector_it&) = default;
+	constexpr vector_it& operator=(T* ptr) {
 		ptr_ = ptr;
 		off_ = 0;
 		return *this;
 	}
 public:
-	const reference operator*() const {
+	constexpr const reference operator*() const {
 		return *(ptr_ + off_);
 	}
-	reference operator*() {
+	constexpr reference operator*() {
 		return const_cast<reference>(static_cast<const vector_it&>(*this).operator*());
 	}
-	pointer operator->() const {
+	constexpr pointer operator->() const {
 		return ptr_ + off_;
 	}
+	constexpr reference operator[](const difference_type& diff) const {
+		return ptr_[off_ + diff];
+	}
 public:
-	// TODO 제대로 작동하는지 확인할 것
-	auto operator<=>(const vector_it& o) const {
-		return off_ <=> o.off_;
+	// 같은 원소를 가리키면 같도록 ==, <=> 모두 가리키는 주소로 비교한다.
+	constexpr auto operator<=>(const vector_it& o) const {
+		return operator->() <=> o.operator->();
+	}
+	constexpr bool operator==(const vector_it& o) const {
+		return operator->() == o.operator->();
 	}
 public:
-	vector_it& operator+=(const difference_type& diff) {
+	constexpr vector_it& operator+=(const difference_type& diff) {
 		off_ += diff;
 		return *this;
 	}
-	vector_it& operator-=(const difference_type& diff) {
+	constexpr vector_it& operator-=(const difference_type& diff) {
 		off_ -= diff;
 		return *this;
 	}
-	vector_it& operator++() {
+	constexpr vector_it& operator++() {
 		++off_;
 		return *this;
 	}
-	vector_it& operator--() {
+	constexpr vector_it& operator--() {
 		--off_;
 		return *this;
 	}
-	vector_it& operator++(int) {
+	constexpr vector_it operator++(int) {
 		auto t(*this);
 		++(*this);
 		return t;
 	}
-	vector_it& operator--(int) {
+	constexpr vector_it operator--(int) {
 		auto t(*this);
 		--(*this);
 		return t;
 	}
-	vector_it operator+(const difference_type& diff) {
+	constexpr vector_it operator+(const difference_type& diff) const {
 		return vector_it(ptr_, off_ + diff);
 	}
-	vector_it operator-(const difference_type& diff) {
+	constexpr vector_it operator-(const difference_type& diff) const {
 		return vector_it(ptr_, off_ - diff);
 	}
-	difference_type operator-(const vector_it& o) const {
-		return off_ - o.off_;
+	constexpr difference_type operator-(const vector_it& o) const {
+		return operator->() - o.operator->();
+	}
+	friend constexpr vector_it operator+(const difference_type& diff, const vector_it& it) {
+		return it + diff;
 	}
 protected:
 	T* ptr_;
@@ -88,6 +117,7 @@ public:
 	using vector_it<T>::off_;
 public:
 	using iterator_category = std::random_access_iterator_tag;
+	using iterator_concept = std::random_access_iterator_tag;
 	using value_type = T;
 	using difference_type = std::ptrdiff_t;
 	using pointer = value_type*;
@@ -103,40 +133,130 @@ public: // TODO
 	reference operator*() {}
 }; // class vector_rit
 
-template <class T, class alloc=allocator<T>>
+/// @brief 객체를 `memcpy` 로 옮기고 원본의 소멸자를 생략해도 되는지 여부
+/// @details 기본값은 `std::is_trivially_copyable_v<T>` 이다. 핸들 형식처럼 자기 자신을
+/// 가리키는 포인터가 없는 사용자 정의 형식은 특수화로 직접 지정할 수 있다.
+/// @code
+/// template <> struct rds::is_trivially_relocatable<handle>: std::true_type {};
+/// @endcode
+template <class T>
+struct is_trivially_relocatable: std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/// @brief \p src 에 있는 \p n 개의 원소를 초기화되지 않은 \p dst 로 옮기고 원본을 소멸시킨다.
+/// @details trivially relocatable 한 형식은 `memcpy` 한 번으로 옮긴다(할당자의
+/// `construct`/`destroy` 는 호출되지 않는다). 그렇지 않으면 할당자를 통해
+/// `std::move_if_noexcept` 로 옮기며, 복사 생성자가 예외를 던지면 \p dst 에 생성된
+/// 원소들을 정리하고 다시 던진다. 이때 \p src 는 그대로 유지된다.
+template <class A, class T>
+void relocate(A& a, T* src, std::size_t n, T* dst) {
+	using traits = std::allocator_traits<A>;
+	if constexpr (is_trivially_relocatable_v<T>) {
+		if (n != 0) {
+			std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T) * n);
+		}
+	} else {
+		std::size_t i = 0;
+		try {
+			for (; i < n; ++i) {
+				traits::construct(a, dst + i, std::move_if_noexcept(src[i]));
+			}
+		} catch (...) {
+			for (std::size_t j = 0; j < i; ++j) {
+				traits::destroy(a, dst + j);
+			}
+			throw;
+		}
+		for (std::size_t j = 0; j < n; ++j) {
+			traits::destroy(a, src + j);
+		}
+	}
+}
+
+/// @brief 동적 배열 템플릿 클래스
+/// @tparam alloc 원소의 할당, 생성, 소멸에 사용할 할당자. 상태를 가지는 할당자도 지원하며
+/// 복사/이동/교환 시 `std::allocator_traits` 의 propagate 속성을 따른다.
+/// @tparam growth 재할당 시 새 용량을 결정하는 성장 정책 (\ref growth_x2, \ref growth_x1_5 또는 `next(cap)`을 가진 사용자 정의 자료형)
+template <class T, class alloc=allocator<T>, class growth=growth_x2>
 class vector {
+	using traits = std::allocator_traits<alloc>;
+public:
+	using allocator_type = alloc;
 public:
 	vector() = default;
-	vector(const vector&) = default;
-	vector(vector&&) = default;
-	vector& operator=(const vector&) = default;
-	vector& operator=(vector&&) = default;
-	~vector() {
-		// destroy all elements
-		for (std::size_t i = 0; i < size_; ++i) {
-			(data_ + i)->~T();
+	explicit vector(const alloc& a): alloc_(a) {}
+	// 원소 생성 중 예외가 발생해도 소멸자가 메모리를 해제하도록, 할당자 생성자에 위임한다.
+	vector(const vector& o): vector(traits::select_on_container_copy_construction(o.alloc_)) {
+		copy_from(o);
+	}
+	vector(vector&& o) noexcept: alloc_(std::move(o.alloc_)) {
+		steal(o);
+	}
+	vector& operator=(const vector& o) {
+		if (this == &o) {
+			return *this;
+		}
+		if constexpr (traits::propagate_on_container_copy_assignment::value) {
+			if (alloc_ != o.alloc_) {
+				release();
+			}
+			alloc_ = o.alloc_;
 		}
-		// deallocate
-		::operator delete(data_);
+		clear();
+		copy_from(o);
+		return *this;
 	}
-public: // TODO implement custom allocator
-	vector(std::size_t size): size_(size), capacity_(size) {
-		// allocate
-		data_ = static_cast<T*>(::operator new(sizeof(T) * size));
-
-		// construct
-		for (std::size_t i = 0; i < size_; ++i) {
-			::new (data_ + i) T();
+	vector& operator=(vector&& o) noexcept(traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value) {
+		if (this == &o) {
+			return *this;
 		}
+		if constexpr (traits::propagate_on_container_move_assignment::value) {
+			release();
+			alloc_ = std::move(o.alloc_);
+			steal(o);
+		} else if (alloc_ == o.alloc_) {
+			release();
+			steal(o);
+		} else {
+			// 메모리를 넘겨받을 수 없으므로 원소 단위로 이동한다.
+			clear();
+			reserve(o.size_);
+			for (std::size_t i = 0; i < o.size_; ++i, ++size_) {
+				traits::construct(alloc_, data_ + size_, std::move(o.data_[i]));
+			}
+			o.clear();
+		}
+		return *this;
 	}
-	vector(std::size_t size, const T& val): size_(size), capacity_(size) {
-		// allocate
-		data_ = static_cast<T*>(::operator new(sizeof(T) * size));
-
-		// construct
-		for (std::size_t i = 0; i < size_; ++i) {
-			::new (data_ + i) T(val);
+	~vector() {
+		release();
+	}
+public:
+	vector(std::size_t size, const alloc& a=alloc()): vector(a) {
+		reserve(size);
+		construct_n(alloc_, data_, size);
+		size_ = size;
+	}
+	vector(std::size_t size, const T& val, const alloc& a=alloc()): vector(a) {
+		reserve(size);
+		construct_fill_n(alloc_, data_, size, val);
+		size_ = size;
+	}
+public:
+	alloc get_allocator() const {
+		return alloc_;
+	}
+	void swap(vector& o) noexcept {
+		if constexpr (traits::propagate_on_container_swap::value) {
+			using std::swap;
+			swap(alloc_, o.alloc_);
 		}
+		// propagate 하지 않는 할당자가 서로 다르면 정의되지 않은 행동이다. (std::vector 와 같음)
+		std::swap(data_, o.data_);
+		std::swap(size_, o.size_);
+		std::swap(capacity_, o.capacity_);
 	}
 public:
 	void reserve(std::size_t cap) {
@@ -144,22 +264,21 @@ public:
 			return;
 		}
 
-		capacity_ = cap;
-
-		const auto* prev = data_;
+		T* next = traits::allocate(alloc_, cap);
 
-		// allocate
-		data_ = static_cast<T*>(::operator new(sizeof(T) * capacity_));
-		for (std::size_t i = 0; i < size_; ++i) {
-			// construct
-			::new (data_ + i) T(prev[i]);
+		try {
+			relocate(alloc_, data_, size_, next);
+		} catch (...) {
+			traits::deallocate(alloc_, next, cap);
+			throw;
+		}
 
-			// destroy
-			(prev + i)->~T();
+		if (data_) {
+			traits::deallocate(alloc_, data_, capacity_);
 		}
 
-		// deallocate
-		::operator delete(const_cast<T*>(prev));
+		data_ = next;
+		capacity_ = cap;
 	}
 public:
 	std::size_t size() const {
@@ -172,13 +291,352 @@ public:
 		return size_ == 0;
 	}
 	std::size_t max_size() const {
-		return std::numeric_limits<std::size_t>::max();
+		return traits::max_size(alloc_);
+	}
+public: // 접근
+	const T& operator[](std::size_t i) const {
+		return data_[i];
+	}
+	T& operator[](std::size_t i) {
+		return const_cast<T&>(static_cast<const vector&>(*this)[i]);
+	}
+	const T& front() const {
+		return data_[0];
+	}
+	T& front() {
+		return const_cast<T&>(static_cast<const vector&>(*this).front());
+	}
+	const T& back() const {
+		return data_[size_ - 1];
+	}
+	T& back() {
+		return const_cast<T&>(static_cast<const vector&>(*this).back());
+	}
+	const T* data() const {
+		return data_;
+	}
+	T* data() {
+		return data_;
+	}
+public: // 수정
+	void push_back(const T& v) {
+		emplace_back(v);
+	}
+	void push_back(T&& v) {
+		emplace_back(std::move(v));
+	}
+	/// @brief 맨 뒤에 원소를 생성한다.
+	/// @details 용량이 부족하면 성장 정책에 따라 재할당하므로 분할 상환 O(1)이다.
+	template <class... Args>
+	T& emplace_back(Args&&... args) {
+		if (size_ == capacity_) {
+			// 인자가 이 벡터의 원소를 참조할 수 있으므로, 재할당 전에 먼저 생성한다.
+			T t(std::forward<Args>(args)...);
+			reserve(next_capacity(size_ + 1));
+			traits::construct(alloc_, data_ + size_, std::move(t));
+		} else {
+			traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+		}
+		return data_[size_++];
+	}
+	void pop_back() {
+		traits::destroy(alloc_, data_ + --size_);
+	}
+	void clear() {
+		destroy_n(alloc_, data_, size_);
+		size_ = 0;
+	}
+public: // 반복자
+	using iterator = vector_it<T>;
+	using const_iterator = vector_it<const T>;
+
+	iterator begin() {
+		return iterator(data_, 0);
+	}
+	iterator end() {
+		return iterator(data_, size_);
+	}
+	const_iterator begin() const {
+		return const_iterator(data_, 0);
+	}
+	const_iterator end() const {
+		return const_iterator(data_, size_);
+	}
+	const_iterator cbegin() const {
+		return begin();
+	}
+	const_iterator cend() const {
+		return end();
+	}
+private:
+	/// @brief \p req 개의 원소를 담을 수 있는, 성장 정책에 따른 다음 용량을 반환
+	std::size_t next_capacity(std::size_t req) const {
+		const std::size_t cap = growth::next(capacity_);
+		return cap < req ? req : cap;
+	}
+	/// @brief 모든 원소를 소멸시키고 메모리를 해제한다.
+	void release() {
+		clear();
+		if (data_) {
+			traits::deallocate(alloc_, data_, capacity_);
+		}
+		data_ = nullptr;
+		capacity_ = 0;
+	}
+	/// @brief \p o 의 원소들을 복사한다. 이 벡터는 비어있어야 한다.
+	void copy_from(const vector& o) {
+		reserve(o.size_);
+		construct_copy_n(alloc_, o.data_, o.size_, data_);
+		size_ = o.size_;
+	}
+	/// @brief \p o 의 메모리를 넘겨받는다. 이 벡터는 비어있어야 한다.
+	void steal(vector& o) {
+		data_ = std::exchange(o.data_, nullptr);
+		size_ = std::exchange(o.size_, 0);
+		capacity_ = std::exchange(o.capacity_, 0);
 	}
 
 private:
+	[[no_unique_address]] alloc alloc_;
 	std::size_t size_ = 0;
 	std::size_t capacity_ = 0;
 	T* data_ = nullptr;
 }; // class vector
 
+/// @brief 최대 \p N 개의 원소를 객체 내부에 저장하는 동적 배열 템플릿 클래스
+/// @details 크기가 \p N 이하인 동안에는 힙 할당을 하지 않으며, \p N 을 넘어서 자라면
+/// 할당자를 통해 힙으로 옮겨간다. 한 번 힙으로 옮겨간 뒤에는 다시 내부 저장소로 돌아오지 않는다.
+/// 반복자는 \ref vector 와 같은 \ref vector_it 을 사용한다.
+/// @note 내부 저장소를 사용하는 동안에는 이동 연산이 원소 단위로 이루어지므로 반복자가 무효화된다.
+template <class T, std::size_t N, class alloc=allocator<T>, class growth=growth_x2>
+class small_vector {
+	static_assert(N > 0, "small_vector with no inline capacity; use rds::vector instead");
+	using traits = std::allocator_traits<alloc>;
+public:
+	using allocator_type = alloc;
+public:
+	small_vector() = default;
+	explicit small_vector(const alloc& a): alloc_(a) {}
+	// 원소 생성 중 예외가 발생해도 소멸자가 메모리를 해제하도록, 할당자 생성자에 위임한다.
+	small_vector(const small_vector& o): small_vector(traits::select_on_container_copy_construction(o.alloc_)) {
+		copy_from(o);
+	}
+	small_vector(small_vector&& o) noexcept(std::is_nothrow_move_constructible_v<T>): alloc_(std::move(o.alloc_)) {
+		move_from(o);
+	}
+	small_vector& operator=(const small_vector& o) {
+		if (this == &o) {
+			return *this;
+		}
+		if constexpr (traits::propagate_on_container_copy_assignment::value) {
+			if (alloc_ != o.alloc_) {
+				release();
+			}
+			alloc_ = o.alloc_;
+		}
+		clear();
+		copy_from(o);
+		return *this;
+	}
+	small_vector& operator=(small_vector&& o) {
+		if (this == &o) {
+			return *this;
+		}
+		if constexpr (traits::propagate_on_container_move_assignment::value) {
+			release();
+			alloc_ = std::move(o.alloc_);
+			move_from(o);
+		} else if (alloc_ == o.alloc_) {
+			release();
+			move_from(o);
+		} else {
+			clear();
+			reserve(o.size_);
+			for (std::size_t i = 0; i < o.size_; ++i, ++size_) {
+				traits::construct(alloc_, data_ + size_, std::move(o.data_[i]));
+			}
+			o.clear();
+		}
+		return *this;
+	}
+	~small_vector() {
+		release();
+	}
+public:
+	small_vector(std::size_t size, const alloc& a=alloc()): small_vector(a) {
+		reserve(size);
+		construct_n(alloc_, data_, size);
+		size_ = size;
+	}
+	small_vector(std::size_t size, const T& val, const alloc& a=alloc()): small_vector(a) {
+		reserve(size);
+		construct_fill_n(alloc_, data_, size, val);
+		size_ = size;
+	}
+public:
+	alloc get_allocator() const {
+		return alloc_;
+	}
+	void swap(small_vector& o) {
+		small_vector t(std::move(o));
+		o = std::move(*this);
+		*this = std::move(t);
+	}
+public:
+	void reserve(std::size_t cap) {
+		if (cap <= capacity_) {
+			return;
+		}
+
+		T* next = traits::allocate(alloc_, cap);
+
+		try {
+			relocate(alloc_, data_, size_, next);
+		} catch (...) {
+			traits::deallocate(alloc_, next, cap);
+			throw;
+		}
+
+		if (!is_inline()) {
+			traits::deallocate(alloc_, data_, capacity_);
+		}
+
+		data_ = next;
+		capacity_ = cap;
+	}
+public:
+	std::size_t size() const {
+		return size_;
+	}
+	std::size_t capacity() const {
+		return capacity_;
+	}
+	bool empty() const {
+		return size_ == 0;
+	}
+	std::size_t max_size() const {
+		return traits::max_size(alloc_);
+	}
+	/// @brief 원소들이 객체 내부 저장소에 있는지 여부를 반환
+	bool is_inline() const {
+		return data_ == inline_data();
+	}
+	static constexpr std::size_t inline_capacity() {
+		return N;
+	}
+public: // 접근
+	const T& operator[](std::size_t i) const {
+		return data_[i];
+	}
+	T& operator[](std::size_t i) {
+		return const_cast<T&>(static_cast<const small_vector&>(*this)[i]);
+	}
+	const T& front() const {
+		return data_[0];
+	}
+	T& front() {
+		return const_cast<T&>(static_cast<const small_vector&>(*this).front());
+	}
+	const T& back() const {
+		return data_[size_ - 1];
+	}
+	T& back() {
+		return const_cast<T&>(static_cast<const small_vector&>(*this).back());
+	}
+	const T* data() const {
+		return data_;
+	}
+	T* data() {
+		return data_;
+	}
+public: // 수정
+	void push_back(const T& v) {
+		emplace_back(v);
+	}
+	void push_back(T&& v) {
+		emplace_back(std::move(v));
+	}
+	template <class... Args>
+	T& emplace_back(Args&&... args) {
+		if (size_ == capacity_) {
+			T t(std::forward<Args>(args)...);
+			const std::size_t cap = growth::next(capacity_);
+			reserve(cap < size_ + 1 ? size_ + 1 : cap);
+			traits::construct(alloc_, data_ + size_, std::move(t));
+		} else {
+			traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+		}
+		return data_[size_++];
+	}
+	void pop_back() {
+		traits::destroy(alloc_, data_ + --size_);
+	}
+	void clear() {
+		destroy_n(alloc_, data_, size_);
+		size_ = 0;
+	}
+public: // 반복자
+	using iterator = vector_it<T>;
+	using const_iterator = vector_it<const T>;
+
+	iterator begin() {
+		return iterator(data_, 0);
+	}
+	iterator end() {
+		return iterator(data_, size_);
+	}
+	const_iterator begin() const {
+		return const_iterator(data_, 0);
+	}
+	const_iterator end() const {
+		return const_iterator(data_, size_);
+	}
+	const_iterator cbegin() const {
+		return begin();
+	}
+	const_iterator cend() const {
+		return end();
+	}
+private:
+	T* inline_data() {
+		return reinterpret_cast<T*>(buf_);
+	}
+	const T* inline_data() const {
+		return reinterpret_cast<const T*>(buf_);
+	}
+	/// @brief 모든 원소를 소멸시키고, 힙을 사용하고 있었다면 해제한 뒤 내부 저장소로 돌아간다.
+	void release() {
+		clear();
+		if (!is_inline()) {
+			traits::deallocate(alloc_, data_, capacity_);
+		}
+		data_ = inline_data();
+		capacity_ = N;
+	}
+	void copy_from(const small_vector& o) {
+		reserve(o.size_);
+		construct_copy_n(alloc_, o.data_, o.size_, data_);
+		size_ = o.size_;
+	}
+	/// @brief \p o 의 원소를 넘겨받는다. 이 객체는 비어있고 내부 저장소를 사용 중이어야 한다.
+	/// @details \p o 가 힙을 사용 중이면 메모리를 그대로 넘겨받고, 그렇지 않으면 원소 단위로 옮긴다.
+	void move_from(small_vector& o) {
+		if (o.is_inline()) {
+			relocate(alloc_, o.data_, o.size_, data_);
+			size_ = std::exchange(o.size_, 0);
+		} else {
+			data_ = std::exchange(o.data_, o.inline_data());
+			size_ = std::exchange(o.size_, 0);
+			capacity_ = std::exchange(o.capacity_, N);
+		}
+	}
+
+private:
+	[[no_unique_address]] alloc alloc_;
+	alignas(T) unsigned char buf_[sizeof(T) * N];
+	T* data_ = inline_data();
+	std::size_t size_ = 0;
+	std::size_t capacity_ = N;
+}; // class small_vector
+
 }; // namespace rds
\ No newline at end of file